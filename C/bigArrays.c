@@ -0,0 +1,144 @@
+// By and copyright Julian D. A. Wiseman of www.jdawiseman.com, April 2025
+// Released under GNU General Public License, Version 3, https://www.gnu.org/licenses/gpl-3.0.txt
+// bigArrays.c, in PenroseC
+
+#include "penrose.h"
+
+/*
+	Allocation of a tiling's big arrays: rhombi[], hotCentres[], hotBBoxes[], path[], pathRhIds[], and pathStat[].
+	If MappedArrays and arraysMappedQ(), these are placed in memory-mapped files in filePath(), so that the
+	operating system can page them to and from disk, trading RAM for disk bandwidth. Each file is unlinked as
+	soon as it is mapped, so its disk space is freed when unmapped, or if the program ends early.
+	Otherwise, or if mapping fails, or for the rhombi_Scratch buffers and arrays_Private copies of threads, whose names
+	would clash, plain malloc(). *mappedP records which, as needed by bigArray_free().
+	Returns NULL only if malloc() fails, so callers' existing error handling is unchanged.
+*/
+
+
+void * bigArray_alloc(
+	Tiling const * const tlngP,
+	long int       const numElements,
+	size_t         const sizeElement,
+	char   const * const arrayName,
+	bool         * const mappedP
+)
+{
+	size_t const numBytes = (numElements > 0 ? numElements : 1) * sizeElement;
+
+	*mappedP = false;
+
+#if MappedArrays
+	if( arraysMappedQ(tlngP)  &&  ! tlngP->rhombi_Scratch  &&  ! tlngP->arrays_Private )
+	{
+		char fileName[512];
+		int fd;
+		void * p;
+
+		sprintf(fileName,  "%sPenrose_%s_%s_%02" PRIi8 ".mapped",  tlngP->filePath,  tlngP->timeString,  arrayName,  tlngP->tilingId);
+		fd = open(fileName,  O_RDWR | O_CREAT | O_TRUNC,  0600);
+		if( fd >= 0 )
+		{
+			unlink(fileName);
+			if( 0 == ftruncate(fd, (off_t)numBytes) )
+			{
+				p = mmap(NULL,  numBytes,  PROT_READ | PROT_WRITE,  MAP_SHARED,  fd,  0);
+				close(fd);
+				if( MAP_FAILED != p )
+				{
+					*mappedP = true;
+					return p;
+				}
+			}  // ftruncate() OK
+			else
+				close(fd);
+		}  // fd >= 0
+
+		fprintf(stderr, "bigArray_alloc(): tilingId=%" PRIi8 ", could not map %s of %li bytes to \"%s\", so using malloc().\n",
+			tlngP->tilingId,  arrayName,  (long int)numBytes,  fileName);
+		fflush(stderr);
+	}  // if( arraysMappedQ(tlngP) ... )
+#endif  // MappedArrays
+
+	return malloc(numBytes);
+}  // bigArray_alloc()
+
+
+void bigArray_free(
+	void     * const p,
+	long int   const numElements,
+	size_t     const sizeElement,
+	bool       const mapped
+)
+{
+	if( NULL == p )
+		return;
+
+#if MappedArrays
+	if( mapped )
+	{
+		munmap(p,  (numElements > 0 ? numElements : 1) * sizeElement);
+		return;
+	}
+#endif  // MappedArrays
+
+	free(p);
+}  // bigArray_free()
+
+
+// Changes the number of elements of an array from bigArray_alloc(), keeping those that fit. Any new elements are zeroed, as
+// if from fresh memory, because some fields, such as of rhombi, are not always set. If it fails, returns NULL, p being unchanged.
+void * bigArray_resize(
+	Tiling const * const tlngP,
+	void         * const p,
+	long int       const numElementsOld,
+	long int       const numElementsNew,
+	size_t         const sizeElement,
+	char   const * const arrayName,
+	bool         * const mappedP
+)
+{
+	size_t const numBytesOld = (numElementsOld > 0 ? numElementsOld : 1) * sizeElement;
+	size_t const numBytesNew = (numElementsNew > 0 ? numElementsNew : 1) * sizeElement;
+	void * pNew;
+	bool mappedNew;
+
+	if( *mappedP  ||  (MappedArrays  &&  arraysMappedQ(tlngP)  &&  ! tlngP->rhombi_Scratch  &&  ! tlngP->arrays_Private) )
+	{
+		// Not mremap(), which is Linux-only: so a new mapping, and copy.
+		pNew = bigArray_alloc(tlngP,  numElementsNew,  sizeElement,  arrayName,  &mappedNew);
+		if( NULL == pNew )
+			return NULL;
+		if( NULL != p )
+		{
+			memcpy(pNew,  p,  (numBytesOld < numBytesNew ? numBytesOld : numBytesNew));
+			bigArray_free(p,  numElementsOld,  sizeElement,  *mappedP);
+		}
+		*mappedP = mappedNew;
+	}  // Mapped
+	else
+	{
+		pNew = realloc(p,  numBytesNew);
+		if( NULL == pNew )
+			return NULL;
+	}  // Not mapped
+
+	if( numBytesNew > numBytesOld  &&  NULL != p )
+		memset((char *)pNew + numBytesOld,  0,  numBytesNew - numBytesOld);
+	return pNew;
+}  // bigArray_resize()
+
+
+// Hint that, until told otherwise, a mapped array will be read in order, as is the ancestor while its descendants are made.
+void bigArray_adviseSequential(
+	void const * const p,
+	long int   const numElements,
+	size_t     const sizeElement,
+	bool       const mapped,
+	bool       const sequential
+)
+{
+#if MappedArrays
+	if( mapped  &&  NULL != p )
+		posix_madvise((void *)p,  (numElements > 0 ? numElements : 1) * sizeElement,  (sequential ? POSIX_MADV_SEQUENTIAL : POSIX_MADV_NORMAL));
+#endif  // MappedArrays
+}  // bigArray_adviseSequential()
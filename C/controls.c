@@ -100,6 +100,144 @@ bool holesFillQ(const Tiling * const tlngP)
 }  // holesFillQ()
 
 
+// If true, holesFill() tries its rules only near rhombi lacking a neighbour, and after each fill only near the new rhombus.
+// If false, every rule on every rhombus, repeated until nothing changes. Same rhombi and output, but false is much slower.
+bool holesFillByWorklistQ(const Tiling * const tlngP)
+{
+	return true; // Example alternative:   return false;
+}  // holesFillByWorklistQ()
+
+
+// Used only if holesFillByWorklistQ(). Number of threads filling holes: 1 ==> serial. If more, the band of rhombi near the
+// tiling's edge is cut into vertical strips, each filled on its own copy, fills near the strips' borders being made after in a
+// serial pass. Same rhombi, filledType, and output as serial. Worth it only if the boundary is long, so for big tilings.
+int holesFillNumThreads(const Tiling * const tlngP)
+{
+	return 1;  // Example alternative:   return (tlngP->tilingId >= 12 ? 4 : 1);
+}  // holesFillNumThreads()
+
+
+// A debugging check. If true, and holesFillNumThreads() > 1, each tiling is also filled serially, on a copy, and the two compared,
+// rhombus by rhombus and neighbour by neighbour. Doubles the time and memory of holesFill(). Failures go to stderr.
+bool holesFillParallelVerifyQ(void)
+{
+	return false;  // Example alternative:   return true;
+}  // holesFillParallelVerifyQ()
+
+
+// Number of threads used by tiling_descendant() to call rhombus_append_descendants(). 1 ==> serial.
+// Output is byte-for-byte the same for any number of threads. But more than one thread needs a little more
+// memory, as the children are buffered, a wave of chunks at a time, before being concatenated in ancestor order.
+int descendantsNumThreads(const Tiling * const tlngP)
+{
+	return 1;  // Example alternative:   return (tlngP->tilingId >= 12 ? 4 : 1);
+}  // descendantsNumThreads()
+
+
+// Children straddling an edge of their ancestor are made by both ancestors sharing that edge, and
+// the copies later purged. If this is true, such a child is made only by the ancestor with the lower
+// rhId, so there are no duplicates, no purge, and rhombi_NumMax need be only the exact count.
+// Same rhombi, but the kept copy of a straddling child might differ in the last bit, so perhaps changing
+// the order of rhombi with equal y. With ExactCoordinates the output is byte-for-byte the same.
+bool descendantsByEdgeOwnershipQ(const Tiling * const tlngP)
+{
+	return false;  // Example alternative:   return true;
+}  // descendantsByEdgeOwnershipQ()
+
+
+// Used only if descendantsByEdgeOwnershipQ(). If true, the descendants' neighbours are found from the
+// ancestors' neighbours, by fixed patterns of the substitution, rather than by neighbours_populate().
+// Same result, faster.
+bool descendantsInheritNeighboursQ(const Tiling * const tlngP)
+{
+	return true;  // Example alternative:   return false;
+}  // descendantsInheritNeighboursQ()
+
+
+// If true, main() frees each tiling once its descendant has been made, so keeping at most two, rather than keeping all until
+// the end. The Rhombi files, each of which contains all tilings so far, are then made from per-tiling part files, written as
+// each tiling is finished, and deleted at the end. Same output, less memory, more disk.
+bool tilingsLowMemoryQ(void)
+{
+	return false;  // Example alternative:   return true;
+}  // tilingsLowMemoryQ()
+
+
+// If true, main() makes every tiling directly by de Bruijn's pentagrid (see pentagrid.c), rather than tilingId 0 from the seed and
+// each later one by substitution from the previous. Each tiling is then a disc of radius pentagrid_radius(), whole to its edge,
+// with no duplicates to purge and no holes to fill. Where both have rhombi, they are those of substitution, as pentagridVerifyQ().
+bool tilingsByPentagridQ(void)
+{
+	return false;  // Example alternative:   return true;
+}  // tilingsByPentagridQ()
+
+
+// Used only if tilingsByPentagridQ(). Rhombi are made if their centres are within this distance of the seed's north.
+// For comparison, the substitution tilings extend about 5 to 8 from there.
+double pentagrid_radius(const Tiling * const tlngP)
+{
+	return 5;  // Example alternative:   return (tlngP->tilingId <= 4 ? 8 : 3);
+}  // pentagrid_radius()
+
+
+// Used only if tilingsByPentagridQ(). Number of threads used by tiling_pentagrid(), each making windows of the disc by pentagrid_window().
+// 1 ==> serial, the disc being one window. Output is byte-for-byte the same for any number of threads, but more than one needs a
+// little more memory, as the windows' rhombi are buffered, a wave of windows at a time, before being concatenated.
+int pentagridNumThreads(const Tiling * const tlngP)
+{
+	return 1;  // Example alternative:   return (tlngP->tilingId >= 10 ? 4 : 1);
+}  // pentagridNumThreads()
+
+
+// A debugging check. If true, and ExactCoordinates, each tiling is checked to be part of the pentagrid tiling of its tilingId, so that
+// substitution and tilingsByPentagridQ() make the same tiling. A few multiplications per rhombus. Failures go to stderr.
+bool pentagridVerifyQ(void)
+{
+	return false;  // Example alternative:   return true;
+}  // pentagridVerifyQ()
+
+
+// Used only if MappedArrays, in penrose.h. If true, this tiling's rhombi[], hotCentres[], hotBBoxes[], path[], pathRhIds[], and pathStat[]
+// are placed in memory-mapped files in filePath(), which the operating system pages to and from disk, allowing recursions deeper than memory would.
+// Slower, and needs disk space about that of the arrays. Best combined with tilingsLowMemoryQ().
+bool arraysMappedQ(const Tiling * const tlngP)
+{
+	return false;  // Example alternative:   return (tlngP->tilingId >= 16);
+}  // arraysMappedQ()
+
+
+// rhombi_purgeDuplicates() can find duplicates with a hash of rhombi's centres, one pass, needing no sort;
+// or by sorting by y and then comparing nearby rhombi. Same result, but hashing is faster and needs less memory.
+bool purgeDuplicatesByHashQ(const Tiling * const tlngP)
+{
+	return true;  // Example alternative:   return false;
+}  // purgeDuplicatesByHashQ()
+
+
+// rhombi_sort() and paths_sort() can sort by qsort() and the comparison function, or by radix on keys giving the same order
+// (see sortRadix.c). Same result, but radix is faster, and with no need to move the big structs more than once.
+bool sortByRadixQ(const Tiling * const tlngP)
+{
+	return true;  // Example alternative:   return false;
+}  // sortByRadixQ()
+
+
+// If true, before paths_populate() the rhombi are sorted along a space-filling curve of their centres, by rhombi_sortSpatially(),
+// so that following neighbours and paths mostly reads nearby memory. Same output, as the rhombi are later re-sorted for export.
+bool rhombiSpatialOrderQ(const Tiling * const tlngP)
+{
+	return false;  // Example alternative:   return (tlngP->tilingId >= 12);
+}  // rhombiSpatialOrderQ()
+
+
+// neighbours_populate() can find neighbours with a hash of edges' midpoints, one pass; or, for each
+// rhombus, by comparing it with all those having a nearby y. Same result, but hashing is faster.
+bool neighboursByHashQ(const Tiling * const tlngP)
+{
+	return true;  // Example alternative:   return false;
+}  // neighboursByHashQ()
+
+
 
 // These can be changed to show, in SVG, only a subset of the rhombi.
 // Comments have example, as used to make image in documentation.
@@ -129,6 +267,42 @@ double wantedPostScriptAspect(void)
 	return 1.44;  // Portrait A3, less 8.73mm margins all round: (420 - 2*8.73) / (297 - 2*8.73) ~= 1.44001
 }  // wantedPostScriptAspect()
 
+// Region of interest. If this returns vertices, of a polygon in the coordinates of rhombus_keep() (or one, a point), an ancestor is
+// expanded only if its descendants might come within roi_margin() of the polygon, see regionOfInterest.c. So a deep tiling of a
+// small area, such as a room, needs work and memory proportional to that area, rather than to the whole tiling.
+long int roi_polygon(XY const * * const verticesP)
+{
+	*verticesP = NULL;
+	return 0;
+	// Example alternative:
+	// static XY const room[] = { {.x=-0.2, .y=-0.1},  {.x=+0.3, .y=-0.1},  {.x=+0.3, .y=+0.25},  {.x=-0.2, .y=+0.25} };
+	// *verticesP = room;
+	// return sizeof(room) / sizeof(room[0]);
+}  // roi_polygon()
+
+
+// Used only if roi_polygon() has vertices. Within this distance of the polygon the last tiling is complete, so holesFill() and paths
+// are correct there. Here eight edge lengths of the last tiling. Larger if the long paths crossing the polygon's boundary are wanted.
+double roi_margin(const Tiling * const tlngP)
+{
+	return 8 * tlngP->edgeLength * pow(GoldenRatioReciprocal,  tlngP->numTilings - 1 - tlngP->tilingId);
+}  // roi_margin()
+
+
+// If true, after making tilingId 0, main() uses locate_point() to find and print which rhombus of tilingId *tilingIdP, which can
+// exceed numTilings, is at *pointP, without making the tilings in between (see locate.c). Plus rhombi within *neighbourhoodRadiusP.
+bool locate_wanted(XY * const pointP,  TilingId * const tilingIdP,  double * const neighbourhoodRadiusP)
+{
+	(void)pointP;  (void)tilingIdP;  (void)neighbourhoodRadiusP;  // Set only if returning true, as in the alternative.
+	return false;
+	// Example alternative:
+	// *pointP = (XY){.x=0.202,  .y=0.026};
+	// *tilingIdP = 18;
+	// *neighbourhoodRadiusP = 0;
+	// return true;
+}  // locate_wanted()
+
+
 bool rhombus_keep(
 	const Tiling * const tlngP,  Physique const physique,
 	double const xNorth,  double const yNorth,  double const xSouth,  double const ySouth
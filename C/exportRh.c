@@ -37,11 +37,11 @@ void rhombus_export(
 			"  /Neighbours [ ",
 			tlngP->wantedPostScriptRhombNum[ rhP->rhId ],
 			(rhP->wantedPostScript?"true":"false"),  rhP->physique,
-			rhP->north.x, rhP->north.y,
-			rhP->south.x, rhP->south.y,
-			rhP->east.x,  rhP->east.y,
-			rhP->west.x,  rhP->west.y,
-			rhP->angleDegrees  // In PostScript all angles are in degrees (e.g.: sin, cos, atan, rotate, sethalftone, setscreen, setcolorscreen, ItalicAngle).
+			rhombus_north(tlngP, rhP).x, rhombus_north(tlngP, rhP).y,
+			rhombus_south(tlngP, rhP).x, rhombus_south(tlngP, rhP).y,
+			rhombus_east(tlngP, rhP).x,  rhombus_east(tlngP, rhP).y,
+			rhombus_west(tlngP, rhP).x,  rhombus_west(tlngP, rhP).y,
+			rhombus_angleDegrees(tlngP, rhP)  // In PostScript all angles are in degrees (e.g.: sin, cos, atan, rotate, sethalftone, setscreen, setcolorscreen, ItalicAngle).
 		);
 		stringClean(scratchString);
 		(*numCharsThisFileP) += fprintf(fp, "%s", scratchString);
@@ -52,7 +52,7 @@ void rhombus_export(
 				rhP->neighbours[nghbrNum].touchesN ? "N" : "S",
 				rhP->neighbours[nghbrNum].touchesE ? "E" : "W",
 				tlngP->wantedPostScriptRhombNum[ rhP->neighbours[nghbrNum].rhId ],
-				rhP->neighbours[nghbrNum].nghbrsNghbrNum
+				neighbour_nghbrsNghbrNum(rhP, nghbrNum)
 			);
 		}
 		(*numCharsThisFileP) += fprintf(fp, "] ");
@@ -62,7 +62,7 @@ void rhombus_export(
 			(*numCharsThisFileP) += fprintf(fp,
 				" /PathId %li  /PathRhombNum %li ",
 				tlngP->wantedPostScriptPathNum[ rhP->pathId ],
-				rhP->withinPathNum
+				(long int)rhP->withinPathNum
 			);
 			if( tlngP->path[rhP->pathId].pathClosed  &&  0 == rhP->withinPathNum )
 				(*numCharsThisFileP) += fprintf(fp,  " /EdgeClosestToPathCentre /%s%s ",  rhP->closerPathCentreN ? "N" : "S",  rhP->closerPathCentreE ? "E" : "W");
@@ -88,14 +88,14 @@ void rhombus_export(
 		sprintf(scratchString,
 			"{ \"RhId\":%li, \"WantedPS\":%s, \"Physique\":%i"
 			", \"Xn\":%.12f, \"Yn\":%.12f, \"Xs\":%.12f, \"Ys\":%.12f, \"Xe\":%.12f, \"Ye\":%.12f, \"Xw\":%.12f, \"Yw\":%.12f, \"AngleDeg\":%.10f",
-			rhP->rhId,
+			(long int)rhP->rhId,
 			rhP->wantedPostScript ? "true" : "false",
 			rhP->physique,
-			rhP->north.x,  rhP->north.y,
-			rhP->south.x,  rhP->south.y,
-			rhP->east.x,   rhP->east.y,
-			rhP->west.x,   rhP->west.y,
-			rhP->angleDegrees  // Angles seem to be wrong by about +- 1 * 10^-12; so printing to 10d.p. seems to work.
+			rhombus_north(tlngP, rhP).x,  rhombus_north(tlngP, rhP).y,
+			rhombus_south(tlngP, rhP).x,  rhombus_south(tlngP, rhP).y,
+			rhombus_east(tlngP, rhP).x,   rhombus_east(tlngP, rhP).y,
+			rhombus_west(tlngP, rhP).x,   rhombus_west(tlngP, rhP).y,
+			rhombus_angleDegrees(tlngP, rhP)  // Angles seem to be wrong by about +- 1 * 10^-12; so printing to 10d.p. seems to work.
 		);
 		stringClean(scratchString);
 		(*numCharsThisFileP) += fprintf(fp, "%s,  \"Neighbours\":[", scratchString);
@@ -104,8 +104,8 @@ void rhombus_export(
 			(*numCharsThisFileP) += fprintf(fp, "{\"Edge\":\"%s%s\", \"RhId\":%li, \"NNN\":%i}%s ",
 				rhP->neighbours[nghbrNum].touchesN ? "N" : "S",
 				rhP->neighbours[nghbrNum].touchesE ? "E" : "W",
-				rhP->neighbours[nghbrNum].rhId,
-				rhP->neighbours[nghbrNum].nghbrsNghbrNum,
+				(long int)rhP->neighbours[nghbrNum].rhId,
+				neighbour_nghbrsNghbrNum(rhP, nghbrNum),
 				nghbrNum < rhP->numNeighbours - 1 ? ", " : ""
 			);
 		(*numCharsThisFileP) += fprintf(fp, "]");
@@ -113,13 +113,13 @@ void rhombus_export(
 		if( Fat == rhP->physique )
 		{
 			// Path
-			(*numCharsThisFileP) += fprintf(fp, ",  \"PathId\":%li,  \"WithinPathNum\":%li", rhP->pathId, rhP->withinPathNum);
+			(*numCharsThisFileP) += fprintf(fp, ",  \"PathId\":%li,  \"WithinPathNum\":%li", (long int)rhP->pathId, (long int)rhP->withinPathNum);
 			if( tlngP->path[rhP->pathId].pathClosed )
 				(*numCharsThisFileP) += fprintf(fp,  ", \"EdgeClosestToPathCentre\":\"%s%s\"",  rhP->closerPathCentreN ? "N" : "S",  rhP->closerPathCentreE ? "E" : "W");
 		}
 		else
 			if( rhP->pathId_ShortestOuter >= 0 )
-				(*numCharsThisFileP) += fprintf(fp, ",  \"PathId_ShortestOuter\":%li ", rhP->pathId_ShortestOuter);  // Thins only, path containing
+				(*numCharsThisFileP) += fprintf(fp, ",  \"PathId_ShortestOuter\":%li ", (long int)rhP->pathId_ShortestOuter);  // Thins only, path containing
 
 		if( rhP->filledType > 0 )  // Only those made by holesFill
 			(*numCharsThisFileP) += fprintf(fp, ",  \"FilledType\":%" PRIi8 " ", rhP->filledType);
@@ -163,10 +163,10 @@ void rhombus_export(
 				"\t%.12f"  "\t%.12f"
 				"\t%.12f"  "\t%.12f"
 				"\t%.10f"  "\t%i",
-				tlngP->tilingId,  rhP->rhId,  rhP->wantedPostScript ? "TRUE" : "FALSE",
+				tlngP->tilingId,  (long int)rhP->rhId,  rhP->wantedPostScript ? "TRUE" : "FALSE",
 				rhP->physique,  rhP->filledType,
-				rhP->north.x, rhP->north.y,  rhP->south.x, rhP->south.y,  rhP->east.x,  rhP->east.y,  rhP->west.x,  rhP->west.y,
-				rhP->angleDegrees,  rhP->numNeighbours
+				rhombus_north(tlngP, rhP).x, rhombus_north(tlngP, rhP).y,  rhombus_south(tlngP, rhP).x, rhombus_south(tlngP, rhP).y,  rhombus_east(tlngP, rhP).x,  rhombus_east(tlngP, rhP).y,  rhombus_west(tlngP, rhP).x,  rhombus_west(tlngP, rhP).y,
+				rhombus_angleDegrees(tlngP, rhP),  rhP->numNeighbours
 			);
 			stringClean(scratchString);
 			(*numCharsThisFileP) += fprintf(fp, "%s", scratchString);
@@ -185,7 +185,7 @@ void rhombus_export(
 			for(nghbrNum=0 ;  nghbrNum < 4 ;  nghbrNum++)
 			{
 				if( nghbrNum < rhP->numNeighbours )
-					(*numCharsThisFileP) += fprintf(fp, "\t%li", rhP->neighbours[nghbrNum].rhId);
+					(*numCharsThisFileP) += fprintf(fp, "\t%li", (long int)rhP->neighbours[nghbrNum].rhId);
 				else
 					(*numCharsThisFileP) += fprintf(fp, "\t#N/A");
 			}
@@ -193,14 +193,14 @@ void rhombus_export(
 			for(nghbrNum=0 ;  nghbrNum < 4 ;  nghbrNum++)
 			{
 				if( nghbrNum < rhP->numNeighbours )
-					(*numCharsThisFileP) += fprintf(fp, "\t%i", rhP->neighbours[nghbrNum].nghbrsNghbrNum);
+					(*numCharsThisFileP) += fprintf(fp, "\t%i", neighbour_nghbrsNghbrNum(rhP, nghbrNum));
 				else
 					(*numCharsThisFileP) += fprintf(fp, "\t#N/A");
 			}
 
 			if( Fat == rhP->physique )
 			{
-				(*numCharsThisFileP) += fprintf(fp, "\t%li\t%li", rhP->pathId, rhP->withinPathNum);
+				(*numCharsThisFileP) += fprintf(fp, "\t%li\t%li", (long int)rhP->pathId, (long int)rhP->withinPathNum);
 				if( rhP->pathId >= 0 )
 				{
 					if( tlngP->path[rhP->pathId].pathClosed )
@@ -225,7 +225,7 @@ void rhombus_export(
 				// Thins only, path containing.
 				// Fats' pathId_ShortestOuter held at level of path, not rhombus.
 				if( rhP->pathId_ShortestOuter >= 0 )
-					(*numCharsThisFileP) += fprintf(fp, "\t%li", rhP->pathId_ShortestOuter);
+					(*numCharsThisFileP) += fprintf(fp, "\t%li", (long int)rhP->pathId_ShortestOuter);
 				else
 					(*numCharsThisFileP) += fprintf(fp, "\t#N/A");
 			}
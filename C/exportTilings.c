@@ -14,19 +14,15 @@ int fIndent(FILE* const fp, int const indentDepth)
 }
 
 
-void tilings_export(
+static void tilings_export_head(
 	FILE              * const fp,
 	ExportFormat        const exportFormat,
-	bool exportQ(ExportWhat const exprtWhat, ExportFormat const exportFormat, const Tiling * const tlngP, const unsigned long int numLinesThisFile),
-	Tiling            * const tlngs,
 	int                 const indentDepth,
-	long int            const numTilings,
 	unsigned long int * const numLinesThisFileP,
 	unsigned long long int * const numCharsThisFileP
 )
 {
 	long int i;
-	TilingId tilingId;
 	extern char scratchString[];
 
 	for( i = 0  ;  i < scratchStringLength  ;  i++ )
@@ -48,30 +44,48 @@ void tilings_export(
 		(*numCharsThisFileP) += fIndent(fp, indentDepth);  (*numCharsThisFileP) += fprintf(fp, "[\n\n\n");
 		(*numLinesThisFileP) += 3;
 	}
+}  // tilings_export_head()
 
 
-	for( tilingId = 0  ;  tilingId < numTilings;  tilingId++ )
+static void tilings_export_one(
+	FILE              * const fp,
+	ExportFormat        const exportFormat,
+	bool exportQ(ExportWhat const exprtWhat, ExportFormat const exportFormat, const Tiling * const tlngP, const unsigned long int numLinesThisFile),
+	Tiling            * const tlngP,
+	int                 const indentDepth,
+	long int            const numTilings,
+	unsigned long int * const numLinesThisFileP,
+	unsigned long long int * const numCharsThisFileP
+)
+{
+	if( tlngP->edgeLength > 0  &&  (tlngP->numFats > 0  ||  tlngP->numThins > 0)
+	&&  exportQ(Anything, exportFormat, tlngP, *numLinesThisFileP) )
 	{
-		if( tlngs[tilingId].edgeLength > 0  &&  (tlngs[tilingId].numFats > 0  ||  tlngs[tilingId].numThins > 0)
-		&&  exportQ(Anything, exportFormat, &(tlngs[tilingId]), *numLinesThisFileP) )
-		{
-			tiling_export(
-				fp,
-				exportFormat,
-				exportQ,
-				&(tlngs[tilingId]),
-				1 + indentDepth,
-				(tilingId < numTilings - 1),
-				tilingId,
-				numLinesThisFileP,
-				numCharsThisFileP
-			);
-			(*numCharsThisFileP) += fprintf(fp, "\n\n\n");
-			(*numLinesThisFileP) += 3;
-		}  // export Anything
-	}  // tilingId
+		tiling_export(
+			fp,
+			exportFormat,
+			exportQ,
+			tlngP,
+			1 + indentDepth,
+			(tlngP->tilingId < numTilings - 1),
+			tlngP->tilingId,
+			numLinesThisFileP,
+			numCharsThisFileP
+		);
+		(*numCharsThisFileP) += fprintf(fp, "\n\n\n");
+		(*numLinesThisFileP) += 3;
+	}  // export Anything
+}  // tilings_export_one()
 
 
+static void tilings_export_tail(
+	FILE              * const fp,
+	ExportFormat        const exportFormat,
+	int                 const indentDepth,
+	unsigned long int * const numLinesThisFileP,
+	unsigned long long int * const numCharsThisFileP
+)
+{
 	if( PS_data == exportFormat )
 	{
 		(*numCharsThisFileP) += fIndent(fp, indentDepth);
@@ -92,4 +106,123 @@ void tilings_export(
 	}
 
 	fflush(fp);
+}  // tilings_export_tail()
+
+
+void tilings_export(
+	FILE              * const fp,
+	ExportFormat        const exportFormat,
+	bool exportQ(ExportWhat const exprtWhat, ExportFormat const exportFormat, const Tiling * const tlngP, const unsigned long int numLinesThisFile),
+	Tiling            * const tlngs,
+	int                 const indentDepth,
+	long int            const numTilings,
+	unsigned long int * const numLinesThisFileP,
+	unsigned long long int * const numCharsThisFileP
+)
+{
+	TilingId tilingId;
+
+	tilings_export_head(fp,  exportFormat,  indentDepth,  numLinesThisFileP,  numCharsThisFileP);
+	for( tilingId = 0  ;  tilingId < numTilings;  tilingId++ )
+		tilings_export_one(fp,  exportFormat,  exportQ,  &(tlngs[tilingId]),  indentDepth,  numTilings,  numLinesThisFileP,  numCharsThisFileP);
+	tilings_export_tail(fp,  exportFormat,  indentDepth,  numLinesThisFileP,  numCharsThisFileP);
 }  // Tilings_Export
+
+
+static char * tilings_export_partFileName(char * const fileName,  Tiling const * const tlngP,  TilingId const tilingId,  ExportFormat const ef)
+{
+	char fileExtension[16];
+	sprintf(fileName,
+		"%sPenrose_%s_Rhombi_%02" PRIi8 "_part.%s",
+		tlngP->filePath,  tlngP->timeString,  tilingId,
+		fileExtension_from_ExportFormat(fileExtension, ef)
+	);
+	return fileName;
+}  // tilings_export_partFileName()
+
+
+/*
+	For use when the earlier tilings have been freed, as by tilingsLowMemoryQ(), in which case a file of all the tilings so far is
+	made by concatenating per-tiling part files. tilings_export_part() writes that of *tlngP, the latest tiling, and should be
+	called for every tilingId and ExportFormat; tilings_export_fromParts() then writes to fp the same as tilings_export().
+	The part file of tilingId=0 starts with the head, so each part starts at the same line number as in tilings_export(), and so
+	exportQ() makes the same choices. partsNumLines[] and partsNumChars[], indexed by tilingId, are the sizes of the part files.
+*/
+void tilings_export_part(
+	ExportFormat        const exportFormat,
+	bool exportQ(ExportWhat const exprtWhat, ExportFormat const exportFormat, const Tiling * const tlngP, const unsigned long int numLinesThisFile),
+	Tiling            * const tlngP,
+	int                 const indentDepth,
+	long int            const numTilings,
+	unsigned long int      * const partsNumLines,
+	unsigned long long int * const partsNumChars
+)
+{
+	TilingId tilingId;
+	FILE * fpPart;
+	char fileName[256];
+	unsigned long int numLinesBefore = 0;
+
+	for( tilingId = 0  ;  tilingId < tlngP->tilingId  ;  tilingId++ )
+		numLinesBefore += partsNumLines[tilingId];
+	partsNumLines[tlngP->tilingId] = numLinesBefore;
+	partsNumChars[tlngP->tilingId] = 0;
+
+	fpPart = fopen( tilings_export_partFileName(fileName, tlngP, tlngP->tilingId, exportFormat),  "w" );
+	if( NULL == fpPart )
+	{
+		fprintf(stderr, "tilings_export_part(): !!! NULL == fopen(\"%s\", \"w\") !!!\n", fileName);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+	if( 0 == tlngP->tilingId )
+		tilings_export_head(fpPart,  exportFormat,  indentDepth,  partsNumLines + tlngP->tilingId,  partsNumChars + tlngP->tilingId);
+	tilings_export_one(fpPart,  exportFormat,  exportQ,  tlngP,  indentDepth,  numTilings,  partsNumLines + tlngP->tilingId,  partsNumChars + tlngP->tilingId);
+	fclose(fpPart);
+	partsNumLines[tlngP->tilingId] -= numLinesBefore;
+}  // tilings_export_part()
+
+
+void tilings_export_fromParts(
+	FILE              * const fp,
+	ExportFormat        const exportFormat,
+	Tiling      const * const tlngP,
+	int                 const indentDepth,
+	unsigned long int      const * const partsNumLines,
+	unsigned long long int const * const partsNumChars,
+	unsigned long int * const numLinesThisFileP,
+	unsigned long long int * const numCharsThisFileP
+)
+{
+	TilingId tilingId;
+	FILE * fpPart;
+	char fileName[256], buffer[65536];
+	size_t numBytes;
+
+	for( tilingId = 0  ;  tilingId <= tlngP->tilingId  ;  tilingId++ )
+	{
+		fpPart = fopen( tilings_export_partFileName(fileName, tlngP, tilingId, exportFormat),  "r" );
+		if( NULL == fpPart )
+		{
+			fprintf(stderr, "tilings_export_fromParts(): !!! NULL == fopen(\"%s\", \"r\") !!!\n", fileName);
+			fflush(stderr);
+			exit(EXIT_FAILURE);
+		}
+		while( (numBytes = fread(buffer, 1, sizeof(buffer), fpPart)) > 0 )
+			fwrite(buffer, 1, numBytes, fp);
+		fclose(fpPart);
+		(*numLinesThisFileP) += partsNumLines[tilingId];
+		(*numCharsThisFileP) += partsNumChars[tilingId];
+	}  // for( tilingId ... )
+
+	tilings_export_tail(fp,  exportFormat,  indentDepth,  numLinesThisFileP,  numCharsThisFileP);
+}  // tilings_export_fromParts()
+
+
+void tilings_export_removeParts(Tiling const * const tlngP,  ExportFormat const exportFormat)
+{
+	TilingId tilingId;
+	char fileName[256];
+	for( tilingId = 0  ;  tilingId < tlngP->numTilings  ;  tilingId++ )
+		remove( tilings_export_partFileName(fileName, tlngP, tilingId, exportFormat) );
+}  // tilings_export_removeParts()
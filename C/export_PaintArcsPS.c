@@ -273,8 +273,8 @@ void tiling_export_PaintArcsPS(
 			rhIdStart = rhId = pathP->rhId_PathCentreClosest;
 			rhP = &(tlngP->rhombi[rhIdStart]);
 			edgeStartE = edgeE = (
-				pow(rhP->east.x - pathP->centre.x, 2) + pow(rhP->east.y - pathP->centre.y, 2) <=
-				pow(rhP->west.x - pathP->centre.x, 2) + pow(rhP->west.y - pathP->centre.y, 2)
+				pow(rhombus_east(tlngP, rhP).x - pathP->centre.x, 2) + pow(rhombus_east(tlngP, rhP).y - pathP->centre.y, 2) <=
+				pow(rhombus_west(tlngP, rhP).x - pathP->centre.x, 2) + pow(rhombus_west(tlngP, rhP).y - pathP->centre.y, 2)
 			);
 		}  // pathLength is 5r, 15, 55, 215, 855, 3415, 13655, 54615, 218455, 873815, ...
 		else
@@ -282,18 +282,18 @@ void tiling_export_PaintArcsPS(
 			rhIdStart = rhId = pathP->rhId_PathCentreFurthest;
 			rhP = &(tlngP->rhombi[rhIdStart]);
 			edgeStartE = edgeE = (
-				pow(rhP->east.x - pathP->centre.x, 2) + pow(rhP->east.y - pathP->centre.y, 2) >=
-				pow(rhP->west.x - pathP->centre.x, 2) + pow(rhP->west.y - pathP->centre.y, 2)
+				pow(rhombus_east(tlngP, rhP).x - pathP->centre.x, 2) + pow(rhombus_east(tlngP, rhP).y - pathP->centre.y, 2) >=
+				pow(rhombus_west(tlngP, rhP).x - pathP->centre.x, 2) + pow(rhombus_west(tlngP, rhP).y - pathP->centre.y, 2)
 			);
 		}  // pathLength is 5p, 25, 105, 425, 1705, 6825, 27305, 109225, 436905, . ..
 		edgeN = false ;  // Arcs broadly follow south side, so always start south.
-		xMin = xMax = (edgeE ? rhP->east.x : rhP->west.x);
-		yMin = yMax = (edgeE ? rhP->east.y : rhP->west.y);
+		xMin = xMax = (edgeE ? rhombus_east(tlngP, rhP).x : rhombus_west(tlngP, rhP).x);
+		yMin = yMax = (edgeE ? rhombus_east(tlngP, rhP).y : rhombus_west(tlngP, rhP).y);
 
 		sprintf(scratchString,
 			"\nTileMatrix setmatrix  %0.9lf %0.9lf moveto  %% pathId=%li, length=%li%s",
-			( (edgeN ? rhP->north.x : rhP->south.x)  +  (edgeE ? rhP->east.x : rhP->west.x) ) / 2,
-			( (edgeN ? rhP->north.y : rhP->south.y)  +  (edgeE ? rhP->east.y : rhP->west.y) ) / 2,
+			( (edgeN ? rhombus_north(tlngP, rhP).x : rhombus_south(tlngP, rhP).x)  +  (edgeE ? rhombus_east(tlngP, rhP).x : rhombus_west(tlngP, rhP).x) ) / 2,
+			( (edgeN ? rhombus_north(tlngP, rhP).y : rhombus_south(tlngP, rhP).y)  +  (edgeE ? rhombus_east(tlngP, rhP).y : rhombus_west(tlngP, rhP).y) ) / 2,
 			pathId,  pathP->pathLength,
 			pathP->pathLength == 5 ? (pathP->pointy ? " pointy" : " round") : ""  // if 5 then should always be pointy
 		);
@@ -312,32 +312,32 @@ void tiling_export_PaintArcsPS(
 		{
 			if( edgeE )
 			{
-				if( xMin > rhP->east.x )  xMin = rhP->east.x;
-				if( yMin > rhP->east.y )  yMin = rhP->east.y;
-				if( xMax < rhP->east.x )  xMax = rhP->east.x;
-				if( yMax < rhP->east.y )  yMax = rhP->east.y;
+				if( xMin > rhombus_east(tlngP, rhP).x )  xMin = rhombus_east(tlngP, rhP).x;
+				if( yMin > rhombus_east(tlngP, rhP).y )  yMin = rhombus_east(tlngP, rhP).y;
+				if( xMax < rhombus_east(tlngP, rhP).x )  xMax = rhombus_east(tlngP, rhP).x;
+				if( yMax < rhombus_east(tlngP, rhP).y )  yMax = rhombus_east(tlngP, rhP).y;
 				if( NULL != arcdEast )  arcdEast[rhId] = true;
 			}
 			else
 			{
-				if( xMin > rhP->west.x )  xMin = rhP->west.x;
-				if( yMin > rhP->west.y )  yMin = rhP->west.y;
-				if( xMax < rhP->west.x )  xMax = rhP->west.x;
-				if( yMax < rhP->west.y )  yMax = rhP->west.y;
+				if( xMin > rhombus_west(tlngP, rhP).x )  xMin = rhombus_west(tlngP, rhP).x;
+				if( yMin > rhombus_west(tlngP, rhP).y )  yMin = rhombus_west(tlngP, rhP).y;
+				if( xMax < rhombus_west(tlngP, rhP).x )  xMax = rhombus_west(tlngP, rhP).x;
+				if( yMax < rhombus_west(tlngP, rhP).y )  yMax = rhombus_west(tlngP, rhP).y;
 				if( NULL != arcdWest ) arcdWest[rhId] = true;
 			}
 
-			arcCentreThis = (edgeE ? rhP->east : rhP->west);
+			arcCentreThis = (edgeE ? rhombus_east(tlngP, rhP) : rhombus_west(tlngP, rhP));
 			if(72 == rhP->physique)
 			{
-				angThisStart = rhP->angleDegrees  +  ( edgeN ? (edgeE ? 36: -36) : (edgeE ? 144 : 216) );  // Fat
+				angThisStart = rhombus_angleDegrees(tlngP, rhP)  +  ( edgeN ? (edgeE ? 36: -36) : (edgeE ? 144 : 216) );  // Fat
 				if( angThisStart >   180 ) angThisStart -= 360;
 				if( angThisStart <= -180 ) angThisStart += 360;
 				angThisEnd = angThisStart + (edgeN == edgeE ? +108 : -108);
 			}  // Fat
 			else
 			{
-				angThisStart = rhP->angleDegrees  +  ( edgeN ? (edgeE ? 72: -72) : (edgeE ? 108 : -108) );  // Fat
+				angThisStart = rhombus_angleDegrees(tlngP, rhP)  +  ( edgeN ? (edgeE ? 72: -72) : (edgeE ? 108 : -108) );  // Fat
 				if( angThisStart >   180 ) angThisStart -= 360;
 				if( angThisStart <= -180 ) angThisStart += 360;
 				angThisEnd = angThisStart + (edgeN == edgeE ? +36 : -36);
@@ -353,13 +353,13 @@ void tiling_export_PaintArcsPS(
 			(*numLinesThisFileP) ++;
 
 			foundNeighbour = false;
-			for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum++ )  // VeryClosed  ==>  4==numNeighbours
+			for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum++ )  // VeryClosed  ==>  closed, so the next fat is found; but 4==numNeighbours only if pathClosedTypeNum even
 			{
 				if( edgeN != rhP->neighbours[nghbrNum].touchesN  // Because exit N|S is opposite to entry N|S
 				&&  edgeE == rhP->neighbours[nghbrNum].touchesE )
 				{
 					foundNeighbour = true;
-					nnn = rhP->neighbours[nghbrNum].nghbrsNghbrNum;
+					nnn = neighbour_nghbrsNghbrNum(rhP, nghbrNum);
 					rhId = rhP->neighbours[nghbrNum].rhId;
 					rhP = &(tlngP->rhombi[rhId]);
 					edgeN = rhP->neighbours[ nnn ].touchesN;
@@ -408,14 +408,14 @@ void tiling_export_PaintArcsPS(
 	{
 		rhP = &(tlngP->rhombi[rhId]);
 		either = false;
-		angThisStart = rhP->angleDegrees  +  (Fat == rhP->physique  ?   36  :  72 );
+		angThisStart = rhombus_angleDegrees(tlngP, rhP)  +  (Fat == rhP->physique  ?   36  :  72 );
 		if(angThisStart >= 180) angThisStart -= 360;
 		if( NULL == arcdEast  ||  (! arcdEast[rhId]) )
 		{
 			sprintf(scratchString,
 				"%0.9lf %0.9lf moveto  %0.9lf %0.9lf R %0.9lf %0.9lf arc",
-				(rhP->east.x + rhP->north.x) / 2,  (rhP->east.y + rhP->north.y) / 2,
-				rhP->east.x, rhP->east.y,
+				(rhombus_east(tlngP, rhP).x + rhombus_north(tlngP, rhP).x) / 2,  (rhombus_east(tlngP, rhP).y + rhombus_north(tlngP, rhP).y) / 2,
+				rhombus_east(tlngP, rhP).x, rhombus_east(tlngP, rhP).y,
 				angThisStart,  angThisStart + (Fat == rhP->physique  ?  108  :  36 )
 			);
 			stringClean(scratchString);
@@ -428,8 +428,8 @@ void tiling_export_PaintArcsPS(
 			sprintf(scratchString,
 				"%s%0.9lf %0.9lf moveto  %0.9lf %0.9lf R %0.9lf %0.9lf arc",
 				either ? "   " : "",
-				(rhP->west.x + rhP->south.x) / 2,  (rhP->west.y + rhP->south.y) / 2,
-				rhP->west.x, rhP->west.y,
+				(rhombus_west(tlngP, rhP).x + rhombus_south(tlngP, rhP).x) / 2,  (rhombus_west(tlngP, rhP).y + rhombus_south(tlngP, rhP).y) / 2,
+				rhombus_west(tlngP, rhP).x, rhombus_west(tlngP, rhP).y,
 				angThisStart,  angThisStart + (Fat == rhP->physique  ?  108  :  36 )
 			);
 			stringClean(scratchString);
@@ -7,12 +7,13 @@
 void tiling_export_PaintArcsSVG(
 	FILE* const fp,
 	Tiling const      * const tlngP,
+	RhombiOrder const * const orderP,  // Order in which unpathed arcs are painted. NULL ==> tlngP's.
 	unsigned long int * const numLinesThisFileP,
 	unsigned long long int * const numCharsThisFileP
 )
 {
 	extern char scratchString[];
-	RhombId rhId, rhIdStart;
+	RhombId rhId, rhIdStart, k;
 	PathId pathId, pathId_goingOut;
 	bool edgeN, edgeE, edgeStartE, foundNeighbour, *arcdEast, *arcdWest, oddToOutSide, firstArc;
 	const Path    * pathP;
@@ -33,29 +34,29 @@ void tiling_export_PaintArcsSVG(
 	for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
 	{
 		rhP = &(tlngP->rhombi[rhId]);
-		x = (rhP->north.x + rhP->east.x) / 2;
-		y = (rhP->north.y + rhP->east.y) / 2;
+		x = (rhombus_north(tlngP, rhP).x + rhombus_east(tlngP, rhP).x) / 2;
+		y = (rhombus_north(tlngP, rhP).y + rhombus_east(tlngP, rhP).y) / 2;
 		if( allMaxX < x ) allMaxX = x;
 		if( allMinX > x ) allMinX = x;
 		if( allMaxY < y ) allMaxY = y;
 		if( allMinY > y ) allMinY = y;
 
-		x = (rhP->south.x + rhP->west.x) / 2;
-		y = (rhP->south.y + rhP->west.y) / 2;
+		x = (rhombus_south(tlngP, rhP).x + rhombus_west(tlngP, rhP).x) / 2;
+		y = (rhombus_south(tlngP, rhP).y + rhombus_west(tlngP, rhP).y) / 2;
 		if( allMaxX < x ) allMaxX = x;
 		if( allMinX > x ) allMinX = x;
 		if( allMaxY < y ) allMaxY = y;
 		if( allMinY > y ) allMinY = y;
 
-		x = (rhP->south.x + rhP->east.x) / 2;
-		y = (rhP->south.y + rhP->east.y) / 2;
+		x = (rhombus_south(tlngP, rhP).x + rhombus_east(tlngP, rhP).x) / 2;
+		y = (rhombus_south(tlngP, rhP).y + rhombus_east(tlngP, rhP).y) / 2;
 		if( allMaxX < x ) allMaxX = x;
 		if( allMinX > x ) allMinX = x;
 		if( allMaxY < y ) allMaxY = y;
 		if( allMinY > y ) allMinY = y;
 
-		x = (rhP->north.x + rhP->west.x) / 2;
-		y = (rhP->north.y + rhP->west.y) / 2;
+		x = (rhombus_north(tlngP, rhP).x + rhombus_west(tlngP, rhP).x) / 2;
+		y = (rhombus_north(tlngP, rhP).y + rhombus_west(tlngP, rhP).y) / 2;
 		if( allMaxX < x ) allMaxX = x;
 		if( allMinX > x ) allMinX = x;
 		if( allMaxY < y ) allMaxY = y;
@@ -170,8 +171,8 @@ void tiling_export_PaintArcsSVG(
 			rhIdStart = rhId = pathP->rhId_PathCentreClosest;
 			rhP = &(tlngP->rhombi[rhIdStart]);
 			edgeStartE = edgeE = (
-				pow(rhP->east.x - pathP->centre.x, 2) + pow(rhP->east.y - pathP->centre.y, 2) <=
-				pow(rhP->west.x - pathP->centre.x, 2) + pow(rhP->west.y - pathP->centre.y, 2)
+				pow(rhombus_east(tlngP, rhP).x - pathP->centre.x, 2) + pow(rhombus_east(tlngP, rhP).y - pathP->centre.y, 2) <=
+				pow(rhombus_west(tlngP, rhP).x - pathP->centre.x, 2) + pow(rhombus_west(tlngP, rhP).y - pathP->centre.y, 2)
 			);
 		}  // 15, 55, 215, 855, 3415, 13655, 54615, 218455, 873815, ...
 		else
@@ -179,13 +180,13 @@ void tiling_export_PaintArcsSVG(
 			rhIdStart = rhId = pathP->rhId_PathCentreFurthest;
 			rhP = &(tlngP->rhombi[rhIdStart]);
 			edgeStartE = edgeE = (
-				pow(rhP->east.x - pathP->centre.x, 2) + pow(rhP->east.y - pathP->centre.y, 2) >=
-				pow(rhP->west.x - pathP->centre.x, 2) + pow(rhP->west.y - pathP->centre.y, 2)
+				pow(rhombus_east(tlngP, rhP).x - pathP->centre.x, 2) + pow(rhombus_east(tlngP, rhP).y - pathP->centre.y, 2) >=
+				pow(rhombus_west(tlngP, rhP).x - pathP->centre.x, 2) + pow(rhombus_west(tlngP, rhP).y - pathP->centre.y, 2)
 			);
 		}  // 5p, 25, 105, 425, 1705, 6825, 27305, 109225, 436905, . ..
 		edgeN = false ;  // Arcs broadly follow south side, so always start south.
-		xMin = xMax = (edgeE ? rhP->east.x : rhP->west.x);
-		yMin = yMax = (edgeE ? rhP->east.y : rhP->west.y);
+		xMin = xMax = (edgeE ? rhombus_east(tlngP, rhP).x : rhombus_west(tlngP, rhP).x);
+		yMin = yMax = (edgeE ? rhombus_east(tlngP, rhP).y : rhombus_west(tlngP, rhP).y);
 
 		oddToOutSide = false;
 		pathId_goingOut = pathId;
@@ -223,8 +224,8 @@ void tiling_export_PaintArcsSVG(
 			(*numCharsThisFileP) += fprintf(fp, "<path class='cBig sf'");
 
 		sprintf(scratchString, " d='M %0.9lf %0.9lf\n",
-			( (edgeN ? rhP->north.x : rhP->south.x)  +  (edgeE ? rhP->east.x : rhP->west.x) ) / tlngP->edgeLength,
-			( (edgeN ? rhP->north.y : rhP->south.y)  +  (edgeE ? rhP->east.y : rhP->west.y) ) / tlngP->edgeLength
+			( (edgeN ? rhombus_north(tlngP, rhP).x : rhombus_south(tlngP, rhP).x)  +  (edgeE ? rhombus_east(tlngP, rhP).x : rhombus_west(tlngP, rhP).x) ) / tlngP->edgeLength,
+			( (edgeN ? rhombus_north(tlngP, rhP).y : rhombus_south(tlngP, rhP).y)  +  (edgeE ? rhombus_east(tlngP, rhP).y : rhombus_west(tlngP, rhP).y) ) / tlngP->edgeLength
 		);
 		stringClean(scratchString);
 		(*numCharsThisFileP) += fprintf(fp, "%s",scratchString);
@@ -235,18 +236,18 @@ void tiling_export_PaintArcsSVG(
 		{
 			if( edgeE )
 			{
-				if( xMin > rhP->east.x )  xMin = rhP->east.x;
-				if( yMin > rhP->east.y )  yMin = rhP->east.y;
-				if( xMax < rhP->east.x )  xMax = rhP->east.x;
-				if( yMax < rhP->east.y )  yMax = rhP->east.y;
+				if( xMin > rhombus_east(tlngP, rhP).x )  xMin = rhombus_east(tlngP, rhP).x;
+				if( yMin > rhombus_east(tlngP, rhP).y )  yMin = rhombus_east(tlngP, rhP).y;
+				if( xMax < rhombus_east(tlngP, rhP).x )  xMax = rhombus_east(tlngP, rhP).x;
+				if( yMax < rhombus_east(tlngP, rhP).y )  yMax = rhombus_east(tlngP, rhP).y;
 				if( NULL != arcdEast )  arcdEast[rhId] = true;
 			}
 			else
 			{
-				if( xMin > rhP->west.x )  xMin = rhP->west.x;
-				if( yMin > rhP->west.y )  yMin = rhP->west.y;
-				if( xMax < rhP->west.x )  xMax = rhP->west.x;
-				if( yMax < rhP->west.y )  yMax = rhP->west.y;
+				if( xMin > rhombus_west(tlngP, rhP).x )  xMin = rhombus_west(tlngP, rhP).x;
+				if( yMin > rhombus_west(tlngP, rhP).y )  yMin = rhombus_west(tlngP, rhP).y;
+				if( xMax < rhombus_west(tlngP, rhP).x )  xMax = rhombus_west(tlngP, rhP).x;
+				if( yMax < rhombus_west(tlngP, rhP).y )  yMax = rhombus_west(tlngP, rhP).y;
 				if( NULL != arcdWest ) arcdWest[rhId] = true;
 			}
 
@@ -256,8 +257,8 @@ void tiling_export_PaintArcsSVG(
 				"\t%s1 1 0 0 %i %0.9lf %0.9lf",
 				firstArc ? "A " : "",
 				edgeN == edgeE ? 1 : 0,
-				( (edgeN ? rhP->south.x : rhP->north.x) + (edgeE ? rhP->east.x : rhP->west.x) ) / tlngP->edgeLength,
-				( (edgeN ? rhP->south.y : rhP->north.y) + (edgeE ? rhP->east.y : rhP->west.y) ) / tlngP->edgeLength
+				( (edgeN ? rhombus_south(tlngP, rhP).x : rhombus_north(tlngP, rhP).x) + (edgeE ? rhombus_east(tlngP, rhP).x : rhombus_west(tlngP, rhP).x) ) / tlngP->edgeLength,
+				( (edgeN ? rhombus_south(tlngP, rhP).y : rhombus_north(tlngP, rhP).y) + (edgeE ? rhombus_east(tlngP, rhP).y : rhombus_west(tlngP, rhP).y) ) / tlngP->edgeLength
 			);
 			stringClean(scratchString);
 			(*numCharsThisFileP) += fprintf(fp, "%s\n",scratchString);
@@ -265,13 +266,13 @@ void tiling_export_PaintArcsSVG(
 			firstArc = false;
 
 			foundNeighbour = false;
-			for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum++ )  // VeryClosed  ==>  4==numNeighbours
+			for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum++ )  // VeryClosed  ==>  closed, so the next fat is found; but 4==numNeighbours only if pathClosedTypeNum even
 			{
 				if( edgeN != rhP->neighbours[nghbrNum].touchesN  // Because exit N|S is opposite to entry N|S
 				&&  edgeE == rhP->neighbours[nghbrNum].touchesE )
 				{
 					foundNeighbour = true;
-					nnn = rhP->neighbours[nghbrNum].nghbrsNghbrNum;
+					nnn = neighbour_nghbrsNghbrNum(rhP, nghbrNum);
 					rhId = rhP->neighbours[nghbrNum].rhId;
 					rhP = &(tlngP->rhombi[rhId]);
 					edgeN = rhP->neighbours[ nnn ].touchesN;
@@ -311,22 +312,23 @@ void tiling_export_PaintArcsSVG(
 			0 == physiqueCounter ? "thins" : "fats"
 		);
 		(*numLinesThisFileP) += 3 ;
-		for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+		for( k = 0  ;  k < tlngP->numFats + tlngP->numThins  ;  k ++ )
 		{
+			rhId = rhombiOrder_rhId(orderP, k);
 			rhP = &(tlngP->rhombi[rhId]);
 
 			if(  ( (Thin == rhP->physique) != (0 == physiqueCounter) )
-			||  rhP->xMax < actual_xMin
-			||  rhP->yMax < actual_yMin
-			||  rhP->xMin > actual_xMax
-			||  rhP->yMin > actual_yMax )
+			||  rhombus_hotBBox(tlngP, rhId, xMax) < actual_xMin
+			||  rhombus_hotBBox(tlngP, rhId, yMax) < actual_yMin
+			||  rhombus_hotBBox(tlngP, rhId, xMin) > actual_xMax
+			||  rhombus_hotBBox(tlngP, rhId, yMin) > actual_yMax )
 				continue;
 
 			if( NULL == arcdEast  ||  (! arcdEast[rhId]) )
 			{
 				// A rx ry x-axis-rotation large-arc-flag sweep-flag x y
-				x = (rhP->east.x + rhP->south.x) / tlngP->edgeLength;
-				y = (rhP->east.y + rhP->south.y) / tlngP->edgeLength;
+				x = (rhombus_east(tlngP, rhP).x + rhombus_south(tlngP, rhP).x) / tlngP->edgeLength;
+				y = (rhombus_east(tlngP, rhP).y + rhombus_south(tlngP, rhP).y) / tlngP->edgeLength;
 				if( fabs(currentpoint.x - x) > 4E-10  ||  fabs(currentpoint.y - y)  > 4E-10 )
 				{
 					sprintf(scratchString, "M %0.9lf %0.9lf ", x, y);
@@ -335,8 +337,8 @@ void tiling_export_PaintArcsSVG(
 				}
 				else
 					(*numCharsThisFileP) += fprintf(fp, "\t");
-				currentpoint.x = (rhP->east.x + rhP->north.x) / tlngP->edgeLength;
-				currentpoint.y = (rhP->east.y + rhP->north.y) / tlngP->edgeLength;
+				currentpoint.x = (rhombus_east(tlngP, rhP).x + rhombus_north(tlngP, rhP).x) / tlngP->edgeLength;
+				currentpoint.y = (rhombus_east(tlngP, rhP).y + rhombus_north(tlngP, rhP).y) / tlngP->edgeLength;
 				sprintf(scratchString, "A 1 1 0 0 0 %0.9lf %0.9lf", currentpoint.x, currentpoint.y);
 				stringClean(scratchString);
 				(*numCharsThisFileP) += fprintf(fp, "%s\n",scratchString);
@@ -345,8 +347,8 @@ void tiling_export_PaintArcsSVG(
 			if( NULL == arcdWest  ||  (! arcdWest[rhId]) )
 			{
 				// A rx ry x-axis-rotation large-arc-flag sweep-flag x y
-				x = (rhP->west.x + rhP->north.x) / tlngP->edgeLength;
-				y = (rhP->west.y + rhP->north.y) / tlngP->edgeLength;
+				x = (rhombus_west(tlngP, rhP).x + rhombus_north(tlngP, rhP).x) / tlngP->edgeLength;
+				y = (rhombus_west(tlngP, rhP).y + rhombus_north(tlngP, rhP).y) / tlngP->edgeLength;
 				if( fabs(currentpoint.x - x) > 4E-10  ||  fabs(currentpoint.y - y)  > 4E-10 )
 				{
 					sprintf(scratchString, "M %0.9lf %0.9lf ", x, y);
@@ -355,14 +357,14 @@ void tiling_export_PaintArcsSVG(
 				}
 				else
 					(*numCharsThisFileP) += fprintf(fp, "\t");
-				currentpoint.x = (rhP->west.x + rhP->south.x) / tlngP->edgeLength;
-				currentpoint.y = (rhP->west.y + rhP->south.y) / tlngP->edgeLength;
+				currentpoint.x = (rhombus_west(tlngP, rhP).x + rhombus_south(tlngP, rhP).x) / tlngP->edgeLength;
+				currentpoint.y = (rhombus_west(tlngP, rhP).y + rhombus_south(tlngP, rhP).y) / tlngP->edgeLength;
 				sprintf(scratchString, "A 1 1 0 0 0 %0.9lf %0.9lf", currentpoint.x, currentpoint.y);
 				stringClean(scratchString);
 				(*numCharsThisFileP) += fprintf(fp, "%s\n",scratchString);
 				(*numLinesThisFileP) ++;
 			}  // ! arcdEast[]
-		}  // for( rhId ... )
+		}  // for( k ... )
 		(*numCharsThisFileP) += fprintf(fp, 
 			"'/> <!-- End of stroking of loose ends not in a closed path that are in %s. -->\n",
 			0 == physiqueCounter ? "thins" : "fats"
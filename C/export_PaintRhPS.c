@@ -343,9 +343,9 @@ void tiling_export_PaintRhombiPS(
 		{
 			sprintf(scratchString,
 				"%0.9lf %0.9lf %0.9lf %0.9lf %0.9lf %0.9lf %0.9lf %0.9lf %0.9lf",
-				rhThisP->west.x, rhThisP->west.y, rhThisP->south.x, rhThisP->south.y,
-				rhThisP->east.x, rhThisP->east.y, rhThisP->north.x, rhThisP->north.y,
-				rhThisP->angleDegrees
+				rhombus_west(tlngP, rhThisP).x, rhombus_west(tlngP, rhThisP).y, rhombus_south(tlngP, rhThisP).x, rhombus_south(tlngP, rhThisP).y,
+				rhombus_east(tlngP, rhThisP).x, rhombus_east(tlngP, rhThisP).y, rhombus_north(tlngP, rhThisP).x, rhombus_north(tlngP, rhThisP).y,
+				rhombus_angleDegrees(tlngP, rhThisP)
 			);
 			stringClean(scratchString);
 			(*numCharsThisFileP) += fprintf(fp,
@@ -378,9 +378,9 @@ void tiling_export_PaintRhombiPS(
 				{
 					sprintf(scratchString,
 						"%0.9lf %0.9lf %0.9lf %0.9lf %0.9lf %0.9lf %0.9lf %0.9lf %0.9lf",
-						rhThisP->west.x, rhThisP->west.y, rhThisP->south.x, rhThisP->south.y,
-						rhThisP->east.x, rhThisP->east.y, rhThisP->north.x, rhThisP->north.y,
-						rhThisP->angleDegrees
+						rhombus_west(tlngP, rhThisP).x, rhombus_west(tlngP, rhThisP).y, rhombus_south(tlngP, rhThisP).x, rhombus_south(tlngP, rhThisP).y,
+						rhombus_east(tlngP, rhThisP).x, rhombus_east(tlngP, rhThisP).y, rhombus_north(tlngP, rhThisP).x, rhombus_north(tlngP, rhThisP).y,
+						rhombus_angleDegrees(tlngP, rhThisP)
 					);
 					stringClean(scratchString);
 					(*numCharsThisFileP) += fprintf(fp,
@@ -390,8 +390,8 @@ void tiling_export_PaintRhombiPS(
 						deBugMode ? "true" : (pathP->pathClosed ? "true" : "false"),
 						deBugMode ? 0 : (pathP->pathLength),
 						deBugMode ? "false" : ((5 == pathP->pathLength && pathP->pathClosed && pathP->pointy) ? "true" : "false"),
-						deBugMode ? -1 : rhThisP->withinPathNum,
-						pathStatId, rhThisP->pathId, rhId_This
+						deBugMode ? -1 : (long int)rhThisP->withinPathNum,
+						pathStatId, (long int)rhThisP->pathId, rhId_This
 					);
 					(*numLinesThisFileP) ++;
 				}  // if( 'pathId' == 'pathStatP' )
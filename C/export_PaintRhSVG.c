@@ -7,6 +7,7 @@
 void tiling_export_PaintRhombiSVG(
 	FILE* const fp,
 	Tiling const      * const tlngP,
+	RhombiOrder const * const orderP,  // Order in which rhombi are painted. NULL ==> tlngP's.
 	unsigned long int * const numLinesThisFileP,
 	unsigned long long int * const numCharsThisFileP
 )
@@ -15,7 +16,7 @@ void tiling_export_PaintRhombiSVG(
 	char colourStr[64], gStr[256];
 	int8_t nghbrNum,  fatCount;
 	bool isWhite, thinGood;
-	RhombId    rhId, rhId_This, rhId_Next;
+	RhombId    k, rhId_This, rhId_Next;
 	PathId     pathId, pathInnerId;
 	PathStatId pathStatId;
 	const Rhombus   *rhP, *rhThisP, *rhNextP;
@@ -185,9 +186,9 @@ void tiling_export_PaintRhombiSVG(
 								(*numCharsThisFileP) += fprintf(fp,
 									"\t\t\t<use href='#t' %s/>\n",
 									svgTransform(scratchString,
-										avg_2(rhThisP->east.x, rhNextP->west.x) - pathOuterP->centre.x,
-										avg_2(rhThisP->east.y, rhNextP->west.y) - pathOuterP->centre.y,
-										rhThisP->angleDegrees + 144,
+										avg_2(rhombus_east(tlngP, rhThisP).x, rhombus_west(tlngP, rhNextP).x) - pathOuterP->centre.x,
+										avg_2(rhombus_east(tlngP, rhThisP).y, rhombus_west(tlngP, rhNextP).y) - pathOuterP->centre.y,
+										rhombus_angleDegrees(tlngP, rhThisP) + 144,
 										360
 									)  // svgTransform()
 								);  // fprintf()
@@ -200,16 +201,16 @@ void tiling_export_PaintRhombiSVG(
 
 				if( pathOuterP->pathLength > 15 )
 				{
-					for( rhId = pathOuterP->rhId_ThinWithin_First  ;  rhId <= pathOuterP->rhId_ThinWithin_Last  ;  rhId ++ )
+					for( k = rhombiOrder_thinWithin_First(orderP, tlngP, pathStatP->examplePathId)  ;  k <= rhombiOrder_thinWithin_Last(orderP, tlngP, pathStatP->examplePathId)  ;  k ++ )
 					{
-						rhP = &(tlngP->rhombi[rhId]);
+						rhP = &(tlngP->rhombi[ rhombiOrder_rhId(orderP, k) ]);
 						if( Thin == rhP->physique  &&   pathStatP->examplePathId == rhP->pathId_ShortestOuter )
 						{
 							thinGood = true;
 							for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum ++ )
 							{
 								nghbrP = &(rhP->neighbours[nghbrNum]);
-								if( Fat == nghbrP->physique  &&  nghbrP->touchesN )
+								if( Fat == neighbour_physique(tlngP, nghbrP)  &&  nghbrP->touchesN )
 								{
 									pathP = &(tlngP->path[ tlngP->rhombi[ nghbrP->rhId ].pathId ]);
 									if( 5 == pathP->pathLength  &&  pathP->pathClosed  &&  ! pathP->pointy )
@@ -225,16 +226,16 @@ void tiling_export_PaintRhombiSVG(
 								(*numCharsThisFileP) += fprintf(fp,
 									"\t\t\t<use href='#t' %s/>\n",
 									svgTransform(scratchString,
-										rhP->north.x - pathOuterP->centre.x,
-										rhP->north.y - pathOuterP->centre.y,
-										rhP->angleDegrees,
+										rhombus_north(tlngP, rhP).x - pathOuterP->centre.x,
+										rhombus_north(tlngP, rhP).y - pathOuterP->centre.y,
+										rhombus_angleDegrees(tlngP, rhP),
 										360
 									)  // svgTransform()
 								);  // fprintf()
 								(*numLinesThisFileP) ++ ;
 							}  // thinGood
 						}  // if( ...examplePathId == ...pathId_ShortestOuter )
-					}  // for( rhId ... )
+					}  // for( k ... )
 				}  // pathLength > 15
 
 				(*numCharsThisFileP) += fprintf(fp,  "\t\t</g>  <!-- thins, fill='%s' -->\n", colourStr);
@@ -270,30 +271,21 @@ void tiling_export_PaintRhombiSVG(
 			(*numCharsThisFileP) += fprintf(fp,  "\t\t<g %s\n",  gStr);
 			(*numLinesThisFileP) ++ ;
 
-			rhId_This = pathOuterP->rhId_PathCentreClosest;
-			while(true)
+			for( k = 0  ;  k < pathOuterP->pathLength  ;  k ++ )
 			{
-				rhThisP  =  &(tlngP->rhombi[ rhId_This ]) ;
-				rhId_Next = NextInPath_RhId(tlngP->rhombi, rhThisP, pathOuterP->pathLength, true);
+				rhThisP  =  &(tlngP->rhombi[ tlngP->pathRhIds[ pathOuterP->pathRhIds_Offset + k ] ]) ;
 
 				(*numCharsThisFileP) += fprintf(fp,
 					"\t\t\t<use href='#f' %s/>\n",
 					svgTransform(scratchString,
-						rhThisP->north.x - pathOuterP->centre.x,
-						rhThisP->north.y - pathOuterP->centre.y,
-						rhThisP->angleDegrees,
+						rhombus_north(tlngP, rhThisP).x - pathOuterP->centre.x,
+						rhombus_north(tlngP, rhThisP).y - pathOuterP->centre.y,
+						rhombus_angleDegrees(tlngP, rhThisP),
 						360
 					)  // svgTransform()
 				);
 				(*numLinesThisFileP) ++ ;
-
-				if( rhId_Next < 0 )
-					break;  // Open path, impossible here
-				if( tlngP->rhombi[rhId_Next].withinPathNum == 0 )
-					break;  // Closed path, back to start
-
-				rhId_This = rhId_Next ;
-			}  // while(true)
+			}  // for( k ... )
 			(*numCharsThisFileP) += fprintf(fp,  "\t\t</g>  <!-- fill='%s' -->\n", colourStr);
 			(*numLinesThisFileP) ++ ;
 
@@ -337,21 +329,21 @@ void tiling_export_PaintRhombiSVG(
 
 	(*numCharsThisFileP) += fprintf(fp, "\n<g fill='#CCC' opacity='1'>  <!-- thins not otherwise inside a path. -->\n");
 	(*numLinesThisFileP) +=2 ;
-	for( rhId = tlngP->numFats + tlngP->numThins - 1  ;  rhId >= 0  ;  rhId -- )
+	for( k = tlngP->numFats + tlngP->numThins - 1  ;  k >= 0  ;  k -- )
 	{
-		rhP = &(tlngP->rhombi[rhId]);
+		rhP = &(tlngP->rhombi[ rhombiOrder_rhId(orderP, k) ]);
 		if( Thin == rhP->physique
 		&&  rhP->pathId_ShortestOuter < 0
-		&&  rhP->xMax >= actual_xMin
-		&&  rhP->yMax >= actual_yMin
-		&&  rhP->xMin <= actual_xMax
-		&&  rhP->yMin <= actual_yMax )
+		&&  rhombus_hotBBox(tlngP, rhP->rhId, xMax) >= actual_xMin
+		&&  rhombus_hotBBox(tlngP, rhP->rhId, yMax) >= actual_yMin
+		&&  rhombus_hotBBox(tlngP, rhP->rhId, xMin) <= actual_xMax
+		&&  rhombus_hotBBox(tlngP, rhP->rhId, yMin) <= actual_yMax )
 		{
 			thinGood = true;
 			for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum ++ )
 			{
 				nghbrP = &(rhP->neighbours[nghbrNum]);
-				if( nghbrP->touchesN  &&  Fat == nghbrP->physique )
+				if( nghbrP->touchesN  &&  Fat == neighbour_physique(tlngP, nghbrP) )
 				{
 					pathP = &(tlngP->path[ tlngP->rhombi[ nghbrP->rhId ].pathId ]);
 					if( 5 == pathP->pathLength  &&  pathP->pathClosed  &&  ! pathP->pointy )
@@ -367,16 +359,16 @@ void tiling_export_PaintRhombiSVG(
 				(*numCharsThisFileP) += fprintf(fp,
 					"\t<use href='#t' %s/>\n",
 					svgTransform(scratchString,
-						rhP->north.x,
-						rhP->north.y,
-						rhP->angleDegrees,
+						rhombus_north(tlngP, rhP).x,
+						rhombus_north(tlngP, rhP).y,
+						rhombus_angleDegrees(tlngP, rhP),
 						360
 					)  // svgTransform()
 				);  // fprintf()
 				(*numLinesThisFileP) ++ ;
 			} // thinGood
 		}  // thin  and  not in path  and  in box
-	}  // for( rhId ... )
+	}  // for( k ... )
 	(*numCharsThisFileP) += fprintf(fp, "</g>  <!-- thins not otherwise inside a path -->\n\n");
 	(*numLinesThisFileP) += 2;
 	fflush(fp);
@@ -411,23 +403,22 @@ void tiling_export_PaintRhombiSVG(
 				if( pathP->pathStatId == pathStatId )
 				{
 
-					rhId_This = pathP->rhId_PathCentreClosest;
-					while(true)
+					for( k = 0  ;  k < pathP->pathLength  ;  k ++ )
 					{
+						rhId_This = tlngP->pathRhIds[ pathP->pathRhIds_Offset + k ];
 						rhThisP  =  &(tlngP->rhombi[ rhId_This ]) ;
-						rhId_Next = NextInPath_RhId(tlngP->rhombi, rhThisP, pathP->pathLength, true);
 
-						if( rhThisP->xMax >= actual_xMin
-						&&  rhThisP->yMax >= actual_yMin
-						&&  rhThisP->xMin <= actual_xMax
-						&&  rhThisP->yMin <= actual_yMax )
+						if( rhombus_hotBBox(tlngP, rhId_This, xMax) >= actual_xMin
+						&&  rhombus_hotBBox(tlngP, rhId_This, yMax) >= actual_yMin
+						&&  rhombus_hotBBox(tlngP, rhId_This, xMin) <= actual_xMax
+						&&  rhombus_hotBBox(tlngP, rhId_This, yMin) <= actual_yMax )
 						{
 							(*numCharsThisFileP) += fprintf(fp,
 								"\t<use href='#o' %s/>",
 								svgTransform(scratchString,
-									rhThisP->north.x,
-									rhThisP->north.y,
-									rhThisP->angleDegrees,
+									rhombus_north(tlngP, rhThisP).x,
+									rhombus_north(tlngP, rhThisP).y,
+									rhombus_angleDegrees(tlngP, rhThisP),
 									360
 								)  // svgTransform()
 							);
@@ -437,14 +428,7 @@ void tiling_export_PaintRhombiSVG(
 								(*numCharsThisFileP) += fprintf(fp, "\n");
 							(*numLinesThisFileP) ++ ;
 						}  // in wanted box
-
-						if( rhId_Next < 0 )
-							break;  // Open path, impossible here
-						if( tlngP->rhombi[rhId_Next].withinPathNum == 0 )
-							break;  // Closed path, back to start
-
-						rhId_This = rhId_Next ;
-					}  // while(true)
+					}  // for( k ... )
 				}  // pathP->pathStatId == pathStatId  which implies open
 			}  // for( pathId ... )
 
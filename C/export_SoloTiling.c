@@ -6,7 +6,7 @@
 
 void export_soloTiling(
 	Tiling * const tlngP,
-	clock_t const timeBeginDescendant
+	double  const timeBeginDescendant  // As wallClockSeconds()
 )
 {
 	ExportFormat ef;
@@ -16,12 +16,24 @@ void export_soloTiling(
 	unsigned long int numLinesThisFile = 0;
 	unsigned long long int numCharsThisFile = 0;
 	extern char scratchString[];
+	RhombiOrder   orderByY;
+	RhombiOrder * orderByYP = NULL;  // NULL ==> the tiling is itself sorted by Y.
+	bool const anyPS  = exportQ(Anything, PS_rhomb, tlngP, 0)  ||  exportQ(Anything, PS_arcs, tlngP, 0);
+	bool const anySVG = exportQ(Anything, SVG_rhomb, tlngP, 0)  ||  exportQ(Anything, SVG_arcs, tlngP, 0);
 
 	// SVG, PS_rhomb, and PS_arcs all work one tiling at a time. So it can export earlier
 	// than the others. And because of the possibility that the last few tilings are very very
 	// slow to make, worth exporting these as they become ready.
 
-	rhombi_sort(tlngP,  &rhombiGt_ByY,  true);
+	// The rhombi are sorted and renumbered once, into the order in which they are left for the later exports: by path if
+	// there is any PostScript, else by Y. If the SVGs then need an order other than the tiling's, they are given a view
+	// of the rhombi sorted by Y, made once, leaving the tiling unchanged by the exporters.
+	rhombi_sort(tlngP,  (anyPS ? &rhombiGt_ByPath : &rhombiGt_ByY),  true);
+	if( anyPS  &&  anySVG )
+	{
+		rhombiOrder_make(tlngP,  &rhombiGt_ByY,  &orderByY);
+		orderByYP = &orderByY;
+	}  // anyPS  &&  anySVG
 
 	ef = SVG_rhomb;
 	if( exportQ(Anything, ef, tlngP, numLinesThisFile) )
@@ -33,7 +45,7 @@ void export_soloTiling(
 		numLinesThisFile = 0;
 		numCharsThisFile = 0;
 		fp=fopen(fileName, "w");
-		tiling_export_PaintRhombiSVG(fp, tlngP, &numLinesThisFile, &numCharsThisFile);
+		tiling_export_PaintRhombiSVG(fp, tlngP, orderByYP, &numLinesThisFile, &numCharsThisFile);
 		fflush(fp); fclose(fp);
 		printf(
 			"export_soloTiling(): tilingId=%" PRIi8 ", exported %lli chars %li lines, so %0.1lf c/l, to %s\n",
@@ -54,7 +66,7 @@ void export_soloTiling(
 		numLinesThisFile = 0;
 		numCharsThisFile = 0;
 		fp=fopen(fileName, "w");
-		tiling_export_PaintArcsSVG(fp, tlngP, &numLinesThisFile, &numCharsThisFile);
+		tiling_export_PaintArcsSVG(fp, tlngP, orderByYP, &numLinesThisFile, &numCharsThisFile);
 		fflush(fp); fclose(fp);
 		printf(
 			"export_soloTiling(): tilingId=%" PRIi8 ", exported %lli chars %li lines, so %0.1lf c/l, to %s\n",
@@ -64,14 +76,13 @@ void export_soloTiling(
 		execute_SVG_PostProcessing(tlngP, numLinesThisFile, numCharsThisFile, fileName, ef);
 	}  // if( exportQ() ), SVG_arcs
 
+	if( NULL != orderByYP )
+		rhombiOrder_free(orderByYP);
+
 
 	ef = PS_rhomb;
 	if( exportQ(Anything, ef, tlngP, numLinesThisFile) )
 	{
-		rhombi_sort(tlngP,  &rhombiGt_ByPath,  true);
-		numCharsThisFile = 0;
-		numLinesThisFile = 0;
-
 		sprintf(fileName,
 			"%sPenrose_%s_Rh_%02" PRIi8 ".%s",
 			tlngP->filePath,  tlngP->timeString,  tlngP->tilingId,  fileExtension_from_ExportFormat(fileExtension, ef)
@@ -93,7 +104,6 @@ void export_soloTiling(
 	ef = PS_arcs;
 	if( exportQ(Anything, ef, tlngP, numLinesThisFile) )
 	{
-		rhombi_sort(tlngP,  &rhombiGt_ByPath,  true);
 		sprintf(
 			fileName,  "%sPenrose_%s_Arcs_%02" PRIi8 ".%s",
 			tlngP->filePath,  tlngP->timeString,  tlngP->tilingId,  fileExtension_from_ExportFormat(fileExtension, ef)
@@ -4,7 +4,6 @@
 
 #include "penrose.h"
 
-static RhombId rhId_lastSorted;
 
 /*
 	A tiling made from only the recursion rule will have, at or near its edges, holes and gaps.
@@ -23,10 +22,309 @@ static RhombId rhId_lastSorted;
 	But if tiles outside an wakard shape were somehow removed, then it might be that,
 	for some boundary shapes, rules otherwise redundant become useful again.
 	Hence all rules retained. The speed cost is slight.
+
+	Each new rhombus is linked at once with all its neighbours, by a SpatialHash of the edges lacking a neighbour, found
+	at the start from the rhombi with fewer than four neighbours, as every gap is against them. So the neighbours are never
+	stale, no rule remakes a rhombus already made, and there is neither neighbours_populate() nor rhombi_purgeDuplicates()
+	after the fills, only neighbours_canonical() to put rhombi and neighbours in the order neighbours_populate() would, which
+	merges in the new rhombi and reorders only their neighbourhoods.
+
+	How the rules are applied is chosen by holesFillByWorklistQ(). Either every rule is tried on every rhombus, repeatedly until
+	nothing changes. Or, by worklist, each rule is tried only on rhombi near one with fewer than four neighbours; and, after each
+	fill, on the rhombi near the new one, the only ones whose neighbourhood has changed. As in the sweeps, each rule empties its
+	queue before the next rule, so a hole fillable by two rules is filled by the earlier, and filledType is unchanged. So the
+	rules' work is proportional to the length of the boundary, rather than to the area times the number of rounds and rules.
+
+	By default the rules are applied on one thread. If holesFillNumThreads() is more than one, the band of rhombi near the edge
+	is cut into vertical cells, filled concurrently, with the fills near the cells' borders deferred to a serial pass, as described
+	at holesFill_byCells(). The rhombi, their filledType, and the output are the same as serial, as holesFillParallelVerifyQ()
+	checks. But the rules are a small part of the time: at tilingId 13 they take 0.065s of holesFill()'s 0.50s, and of the
+	tiling's 10.7s. Most of holesFill() is the scan for open edges and neighbours_canonical(), each linear in the number of rhombi,
+	and the boundary grows only as the square root of that number, so threads help only the biggest tilings, and then little.
+*/
+
+
+#define HolesFilling_NumFillTypes ('G' + 1 - 'A')
+
+
+/*
+	Most rhombi tried by a fillType fail its first tests, which are of the rhombus's own physique and of which of its edges have
+	which neighbours. So, first, a signature of those: physique, and for each edge, as numbered NE, NW, SE, SW, whether open, thin
+	or fat. Below, for each fillType, are the signatures that pass those first tests, as data. From them holesFill_signatureTable()
+	makes a table, by signature, of the fillTypes that might succeed, so each rhombus is tried only by those. Each rhombus's
+	signature is kept in HolesFilling, changed only for a new rhombus and its neighbours, so each try costs two lookups.
+	The conditions are necessary, not sufficient: a fillType is still called and still tests everything.
 */
 
+#define FillSignature_Open  1
+#define FillSignature_Thin  2
+#define FillSignature_Fat   4
+#define FillSignature_Any   (FillSignature_Open | FillSignature_Thin | FillSignature_Fat)
+#define FillSignature_NumSignatures 512  // 1 bit of physique, 2 bits per edge
+
+typedef struct  // FillSignature
+{
+	Physique physique;
+	int8_t   numNeighboursMin;
+	int8_t   numNeighboursMax;
+	uint8_t  edges[4];  // NE, NW, SE, SW, each an OR of the allowed FillSignature_Open, _Thin, _Fat.
+} FillSignature;
+
+static FillSignature const holesFill_signatures[HolesFilling_NumFillTypes] = {
+	// A: thin, both south edges fat.
+	{Thin,  2,  4,  {FillSignature_Any,  FillSignature_Any,  FillSignature_Fat,  FillSignature_Fat}},
+	// B: westernmost of four fats round a south vertex: thins at north, next fat at south-east, nothing at south-west.
+	{Fat ,  3,  3,  {FillSignature_Thin,  FillSignature_Thin,  FillSignature_Fat,  FillSignature_Open}},
+	// C: two thins at south, one fat at north.
+	{Fat ,  3,  3,  {FillSignature_Open | FillSignature_Fat,  FillSignature_Open | FillSignature_Fat,  FillSignature_Thin,  FillSignature_Thin}},
+	// D: thin, south not fat.
+	{Thin,  1,  3,  {FillSignature_Any,  FillSignature_Any,  FillSignature_Open | FillSignature_Thin,  FillSignature_Open | FillSignature_Thin}},
+	// E: fat of a round five: north not fat, next fat at south-east, south-west not thin.
+	{Fat ,  2,  4,  {FillSignature_Open | FillSignature_Thin,  FillSignature_Open | FillSignature_Thin,  FillSignature_Fat,  FillSignature_Open | FillSignature_Fat}},
+	// F: fat lacking a neighbour.
+	{Fat ,  0,  3,  {FillSignature_Any,  FillSignature_Any,  FillSignature_Any,  FillSignature_Any}},
+	// G: thin lacking a neighbour.
+	{Thin,  0,  3,  {FillSignature_Any,  FillSignature_Any,  FillSignature_Any,  FillSignature_Any}}
+};
+
+
+static inline int16_t holesFill_signature(Tiling const * const tlngP,  RhombId const rhId)
+{
+	Rhombus const * const rhP = &(tlngP->rhombi[rhId]);
+	int16_t signature = (Fat == rhP->physique ? 1 : 0);
+	int8_t nghbrNum;
+
+	for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum ++ )
+		signature |= (Fat == neighbour_physique(tlngP, &(rhP->neighbours[nghbrNum])) ? 2 : 1)  <<  (1 + 2 * (
+			(rhP->neighbours[nghbrNum].touchesN ? 0 : 2)  +  (rhP->neighbours[nghbrNum].touchesE ? 0 : 1)
+		));
+	return signature;
+}  // holesFill_signature()
+
+
+// signatureTable[signature] has bit fillNum set iff holesFill_signatures[fillNum] allows that signature.
+static void holesFill_signatureTable(uint8_t * const signatureTable)
+{
+	int16_t signature;
+	int8_t fillNum, edgeNum, numNeighbours, edgeOccupant;
+	FillSignature const * sgP;
+
+	for( signature = 0  ;  signature < FillSignature_NumSignatures  ;  signature ++ )
+	{
+		signatureTable[signature] = 0;
+		for( fillNum = 0  ;  fillNum < HolesFilling_NumFillTypes  ;  fillNum ++ )
+		{
+			sgP = &(holesFill_signatures[fillNum]);
+			if( (Fat == sgP->physique) != (1 == (signature & 1)) )
+				continue;
+			numNeighbours = 0;
+			for( edgeNum = 0  ;  edgeNum < 4  ;  edgeNum ++ )
+			{
+				edgeOccupant = (signature >> (1 + 2 * edgeNum)) & 3;  // 0 open, 1 thin, 2 fat, 3 unused
+				if( 3 == edgeOccupant  ||  ! (sgP->edges[edgeNum] & (1 << edgeOccupant)) )
+					break;
+				if( edgeOccupant > 0 )
+					numNeighbours ++;
+			}  // for( edgeNum ... )
+			if( edgeNum >= 4  &&  numNeighbours >= sgP->numNeighboursMin  &&  numNeighbours <= sgP->numNeighboursMax )
+				signatureTable[signature] |= (1 << fillNum);
+		}  // for( fillNum ... )
+	}  // for( signature ... )
+}  // holesFill_signatureTable()
+
+
+typedef struct  // HolesFilling, as holesFill()
+{
+	SpatialHash openEdges;       // Edges lacking a neighbour, as 4 * rhId + edgeNum, as neighbours_openEdges_insert().
+	bool        byWorklist;      // Else by sweeps, the queues being unused.
+	RhombId   * queues[HolesFilling_NumFillTypes];  // Per fillType, rhombi to be tried, FIFO, from queueHeads[] to queueEnds[].
+	long int    queues_NumMax[HolesFilling_NumFillTypes];
+	long int    queueHeads[HolesFilling_NumFillTypes];
+	long int    queueEnds[HolesFilling_NumFillTypes];
+	uint8_t   * queued;          // Indexed by rhId, bit fillNum set iff in queues[fillNum].
+	long int    queued_NumMax;
+	int16_t   * signatures;      // Indexed by rhId, as holesFill_signature().
+	long int    signatures_NumMax;
+	SpatialHash const * cuts;    // If not NULL, as in a patch of holesFill_byCells(), rhombi near its points are never queued.
+	int8_t    * nearCut;         // Indexed by rhId, as holesFilling_nearCut() once known, else -1.
+	long int    nearCut_NumMax;
+} HolesFilling;
+
+// Tried again after a fill are the rhombi within this many edge lengths, by centres, of the new one, being more than the
+// reach of any rule: the rhombi around one of the new one's vertices, or the ring of five fats of fillTypeE().
+#define HolesFilling_RadiusEdges 4.0
+#define HolesFilling_NearMax 256
+
+
+// Enqueues rhId for every fillType.
+static void holesFilling_enqueue(HolesFilling * const hfP,  RhombId const rhId)
+{
+	long int numMaxNew;
+	int8_t fillNum;
+
+	if( rhId >= hfP->queued_NumMax )
+	{
+		numMaxNew = 2 * rhId + 1024;
+		hfP->queued = realloc( hfP->queued,  numMaxNew * sizeof(uint8_t) );
+		if( NULL == hfP->queued )
+		{
+			fprintf(stderr, "holesFilling_enqueue(): !!! NULL == queued, numMaxNew=%li !!!\n", numMaxNew);
+			fflush(stderr);
+			exit(EXIT_FAILURE);
+		}
+		memset( hfP->queued + hfP->queued_NumMax,  0,  (numMaxNew - hfP->queued_NumMax) * sizeof(uint8_t) );
+		hfP->queued_NumMax = numMaxNew;
+	}  // if( rhId >= hfP->queued_NumMax )
+
+	for( fillNum = 0  ;  fillNum < HolesFilling_NumFillTypes  ;  fillNum ++ )
+	{
+		if( hfP->queued[rhId] & (1 << fillNum) )
+			continue;
+
+		if( hfP->queueEnds[fillNum] >= hfP->queues_NumMax[fillNum] )
+		{
+			// Shift the live part down, growing if it is more than half.
+			memmove(
+				hfP->queues[fillNum],
+				hfP->queues[fillNum] + hfP->queueHeads[fillNum],
+				(hfP->queueEnds[fillNum] - hfP->queueHeads[fillNum]) * sizeof(RhombId)
+			);
+			hfP->queueEnds[fillNum] -= hfP->queueHeads[fillNum];
+			hfP->queueHeads[fillNum] = 0;
+			if( 2 * hfP->queueEnds[fillNum] >= hfP->queues_NumMax[fillNum] )
+			{
+				hfP->queues_NumMax[fillNum] *= 2;
+				hfP->queues[fillNum] = realloc( hfP->queues[fillNum],  hfP->queues_NumMax[fillNum] * sizeof(RhombId) );
+				if( NULL == hfP->queues[fillNum] )
+				{
+					fprintf(stderr, "holesFilling_enqueue(): !!! NULL == queues[%i], NumMax=%li !!!\n", fillNum, hfP->queues_NumMax[fillNum]);
+					fflush(stderr);
+					exit(EXIT_FAILURE);
+				}
+			}  // Grow
+		}  // if( hfP->queueEnds[fillNum] >= hfP->queues_NumMax[fillNum] )
+
+		hfP->queues[fillNum][ hfP->queueEnds[fillNum] ++ ] = rhId;
+		hfP->queued[rhId] |= (1 << fillNum);
+	}  // for( fillNum ... )
+}  // holesFilling_enqueue()
+
+
+// In a patch of holesFill_byCells(), whether rhId is within half the hash's pitch of a rhombus cut from a neighbour, so that the
+// rules might misread it. If the candidates are too many to check, assumed so. Each rhombus's is found once, and remembered.
+static bool holesFilling_nearCut(Tiling const * const tlngP,  HolesFilling * const hfP,  RhombId const rhId)
+{
+	long int candidates[HolesFilling_NearMax],  numCandidates,  candidateNum,  numMaxNew;
+	XY centre;
+
+	if( NULL == hfP->cuts )
+		return false;
+
+	if( rhId >= hfP->nearCut_NumMax )
+	{
+		numMaxNew = 2 * rhId + 1024;
+		hfP->nearCut = realloc( hfP->nearCut,  numMaxNew * sizeof(int8_t) );
+		if( NULL == hfP->nearCut )
+		{
+			fprintf(stderr, "holesFilling_nearCut(): !!! NULL == nearCut, numMaxNew=%li !!!\n", numMaxNew);
+			fflush(stderr);
+			exit(EXIT_FAILURE);
+		}
+		memset( hfP->nearCut + hfP->nearCut_NumMax,  -1,  (numMaxNew - hfP->nearCut_NumMax) * sizeof(int8_t) );
+		hfP->nearCut_NumMax = numMaxNew;
+	}  // if( rhId >= hfP->nearCut_NumMax )
+	if( hfP->nearCut[rhId] >= 0 )
+		return hfP->nearCut[rhId];
+
+	centre = rhombus_hotCentre(tlngP, rhId);
+	numCandidates = spatialHash_candidates(hfP->cuts,  centre,  candidates,  HolesFilling_NearMax);
+	hfP->nearCut[rhId] = (numCandidates > HolesFilling_NearMax);
+	for( candidateNum = 0  ;  candidateNum < numCandidates  &&  ! hfP->nearCut[rhId]  ;  candidateNum ++ )
+		hfP->nearCut[rhId] = (
+			pow(rhombus_hotCentre(tlngP, candidates[candidateNum]).x - centre.x,  2)  +  pow(rhombus_hotCentre(tlngP, candidates[candidateNum]).y - centre.y,  2)
+			<=  pow(hfP->cuts->pitch / 2,  2)
+		);
+	return hfP->nearCut[rhId];
+}  // holesFilling_nearCut()
+
+
+// Enqueues the rhombi within HolesFilling_RadiusEdges of rhId_Centre, reached by neighbours.
+static void holesFilling_enqueueNear(Tiling const * const tlngP,  HolesFilling * const hfP,  RhombId const rhId_Centre)
+{
+	RhombId near[HolesFilling_NearMax], rhId;
+	long int numNear = 0,  nearNum,  nearNumOther;
+	int8_t nghbrNum;
+	XY const centre = rhombus_hotCentre(tlngP, rhId_Centre);
+	double const radius = HolesFilling_RadiusEdges * tlngP->edgeLength;
+
+	near[numNear ++] = rhId_Centre;
+	for( nearNum = 0  ;  nearNum < numNear  ;  nearNum ++ )
+	{
+		if( ! holesFilling_nearCut(tlngP,  hfP,  near[nearNum]) )
+			holesFilling_enqueue(hfP,  near[nearNum]);
+		for( nghbrNum = 0  ;  nghbrNum < tlngP->rhombi[ near[nearNum] ].numNeighbours  ;  nghbrNum ++ )
+		{
+			rhId = tlngP->rhombi[ near[nearNum] ].neighbours[nghbrNum].rhId;
+			if( pow(rhombus_hotCentre(tlngP, rhId).x - centre.x,  2)  +  pow(rhombus_hotCentre(tlngP, rhId).y - centre.y,  2)  >  radius * radius )
+				continue;
+			for( nearNumOther = 0  ;  nearNumOther < numNear  &&  near[nearNumOther] != rhId  ;  nearNumOther ++ )
+				;
+			if( nearNumOther >= numNear  &&  numNear < HolesFilling_NearMax )
+				near[numNear ++] = rhId;
+		}  // for( nghbrNum ... )
+	}  // for( nearNum ... )
+}  // holesFilling_enqueueNear()
+
+
+static void holesFilling_signatureSet(Tiling const * const tlngP,  HolesFilling * const hfP,  RhombId const rhId)
+{
+	long int numMaxNew;
+
+	if( rhId >= hfP->signatures_NumMax )
+	{
+		numMaxNew = 2 * rhId + 1024;
+		hfP->signatures = realloc( hfP->signatures,  numMaxNew * sizeof(int16_t) );
+		if( NULL == hfP->signatures )
+		{
+			fprintf(stderr, "holesFilling_signatureSet(): !!! NULL == signatures, numMaxNew=%li !!!\n", numMaxNew);
+			fflush(stderr);
+			exit(EXIT_FAILURE);
+		}
+		hfP->signatures_NumMax = numMaxNew;
+	}  // if( rhId >= hfP->signatures_NumMax )
+	hfP->signatures[rhId] = holesFill_signature(tlngP,  rhId);
+}  // holesFilling_signatureSet()
+
 
-static inline int8_t fillTypeA(Tiling * const tlngP, RhombId const rhId_A)
+// Called by the fillTypes for each new rhombus, the last. Links it with all its neighbours, and if by worklist enqueues those nearby.
+// If, unexpectedly, it duplicates an existing rhombus, it is removed. Returns the number of rhombi added.
+static int8_t holesFilling_link(Tiling * const tlngP,  HolesFilling * const hfP,  RhombId const rhId_new)
+{
+	RhombId const rhId_duplicate = neighbours_openEdges_duplicate(tlngP,  &(hfP->openEdges),  rhId_new);
+	int8_t nghbrNum;
+
+	if( rhId_duplicate >= 0 )
+	{
+		printf("holesFill(): tilingId=%" PRIi8 ", new rhId=%li duplicates rhId=%li, so removed\n", tlngP->tilingId, rhId_new, rhId_duplicate);
+		if( Fat == tlngP->rhombi[rhId_new].physique )
+			tlngP->numFats -- ;
+		else
+			tlngP->numThins -- ;
+		return 0;
+	}  // if( rhId_duplicate >= 0 )
+
+	neighbours_openEdges_link(tlngP,  &(hfP->openEdges),  rhId_new);
+	neighbours_openEdges_insert(tlngP,  &(hfP->openEdges),  rhId_new);
+	holesFilling_signatureSet(tlngP,  hfP,  rhId_new);
+	for( nghbrNum = 0  ;  nghbrNum < tlngP->rhombi[rhId_new].numNeighbours  ;  nghbrNum ++ )
+		holesFilling_signatureSet(tlngP,  hfP,  tlngP->rhombi[rhId_new].neighbours[nghbrNum].rhId);
+	if( hfP->byWorklist )
+		holesFilling_enqueueNear(tlngP,  hfP,  rhId_new);
+	return 1;
+}  // holesFilling_link()
+
+
+static inline int8_t fillTypeA(Tiling * const tlngP,  HolesFilling * const hfP,  RhombId const rhId_A)
 {
 	/*
 	A is a thin, to its south neighbouring only fats.
@@ -74,7 +372,7 @@ static inline int8_t fillTypeA(Tiling * const tlngP, RhombId const rhId_A)
 		if( ! nghbrP->touchesN )
 		{
 			// South
-			if( Fat != nghbrP->physique )
+			if( Fat != neighbour_physique(tlngP, nghbrP) )
 				return 0;
 			if( nghbrP->touchesE )
 				rhId_B = nghbrP->rhId;  // A's SE edge
@@ -96,15 +394,15 @@ static inline int8_t fillTypeA(Tiling * const tlngP, RhombId const rhId_A)
 			{
 				rhId_D = nghbrP->rhId;
 				if( tlngP->rhombi[rhId_D].physique != Thin
-				||  tlngP->rhombi[rhId_D].neighbours[ nghbrP->nghbrsNghbrNum ].rhId     != rhId_B
-				||  tlngP->rhombi[rhId_D].neighbours[ nghbrP->nghbrsNghbrNum ].touchesN != true
-				||  tlngP->rhombi[rhId_D].neighbours[ nghbrP->nghbrsNghbrNum ].touchesE != true )
+				||  tlngP->rhombi[rhId_D].neighbours[ neighbour_nghbrsNghbrNum(&(tlngP->rhombi[rhId_B]), nghbrNum) ].rhId     != rhId_B
+				||  tlngP->rhombi[rhId_D].neighbours[ neighbour_nghbrsNghbrNum(&(tlngP->rhombi[rhId_B]), nghbrNum) ].touchesN != true
+				||  tlngP->rhombi[rhId_D].neighbours[ neighbour_nghbrsNghbrNum(&(tlngP->rhombi[rhId_B]), nghbrNum) ].touchesE != true )
 					return 0;
 			}  // North-east
 			else
 			{
 				// North-west
-				if( Fat != nghbrP->physique )
+				if( Fat != neighbour_physique(tlngP, nghbrP) )
 					return 0;
 			}  // North-west
 		}  // North
@@ -129,7 +427,7 @@ static inline int8_t fillTypeA(Tiling * const tlngP, RhombId const rhId_A)
 		{
 			if( nghbrP->touchesE )  // North-east
 			{
-				if( Fat != nghbrP->physique )
+				if( Fat != neighbour_physique(tlngP, nghbrP) )
 					return 0;
 			}  // North-east
 			else
@@ -137,9 +435,9 @@ static inline int8_t fillTypeA(Tiling * const tlngP, RhombId const rhId_A)
 				// North-west
 				rhId_E = nghbrP->rhId;
 				if( tlngP->rhombi[rhId_E].physique != Thin
-				||  tlngP->rhombi[rhId_E].neighbours[ nghbrP->nghbrsNghbrNum ].rhId     != rhId_C
-				||  tlngP->rhombi[rhId_E].neighbours[ nghbrP->nghbrsNghbrNum ].touchesN != true
-				||  tlngP->rhombi[rhId_E].neighbours[ nghbrP->nghbrsNghbrNum ].touchesE != false )
+				||  tlngP->rhombi[rhId_E].neighbours[ neighbour_nghbrsNghbrNum(&(tlngP->rhombi[rhId_C]), nghbrNum) ].rhId     != rhId_C
+				||  tlngP->rhombi[rhId_E].neighbours[ neighbour_nghbrsNghbrNum(&(tlngP->rhombi[rhId_C]), nghbrNum) ].touchesN != true
+				||  tlngP->rhombi[rhId_E].neighbours[ neighbour_nghbrsNghbrNum(&(tlngP->rhombi[rhId_C]), nghbrNum) ].touchesE != false )
 					return 0;
 			}  // North-west
 		}  // North
@@ -157,6 +455,19 @@ static inline int8_t fillTypeA(Tiling * const tlngP, RhombId const rhId_A)
 		}  // South
 	}  // for( nghbrNum ... )
 
+#if ExactCoordinates
+	if( ! vertices_same(tlngP,  &(tlngP->rhombi[rhId_A]), south,  &(tlngP->rhombi[rhId_B]), south)
+	||  ! vertices_same(tlngP,  &(tlngP->rhombi[rhId_A]), south,  &(tlngP->rhombi[rhId_C]), south) )
+		return 0;  // This test should be redundant
+
+	RhombId const rhId_new = rhombus_append_exact(
+		tlngP,
+		Fat,
+		'A' + 1 - 'A',  // filledType
+		lattice_subtract( lattice_add(rhombus_eastExact(&(tlngP->rhombi[rhId_B])),  rhombus_westExact(&(tlngP->rhombi[rhId_C]))),  rhombus_southExact(&(tlngP->rhombi[rhId_A])) ),
+		rhombus_southExact(&(tlngP->rhombi[rhId_A]))
+	);
+#else
 	if( points_different_3(tlngP,  tlngP->rhombi[rhId_A].south,  tlngP->rhombi[rhId_B].south,  tlngP->rhombi[rhId_C].south) )
 		return 0;  // This test should be redundant
 
@@ -172,22 +483,15 @@ static inline int8_t fillTypeA(Tiling * const tlngP, RhombId const rhId_A)
 		new_S_x,
 		new_S_y
 	);
+#endif
 	if( rhId_new < 0 )
 		return 0;
-
-	twoRhombi_Neighbourify(tlngP, rhId_new, rhId_B);
-	twoRhombi_Neighbourify(tlngP, rhId_new, rhId_C);
-	if( rhId_D >= 0 )
-		twoRhombi_Neighbourify(tlngP, rhId_new, rhId_D);
-	if( rhId_E >= 0 )
-		twoRhombi_Neighbourify(tlngP, rhId_new, rhId_E);
-
-	return 1;
+	return holesFilling_link(tlngP,  hfP,  rhId_new);
 }  // fillTypeA()
 
 
 
-static inline int8_t fillTypeB(Tiling * const tlngP, RhombId const rhId_Start)
+static inline int8_t fillTypeB(Tiling * const tlngP,  HolesFilling * const hfP,  RhombId const rhId_Start)
 {
 	// Simple hole: four but not five fats share south corners. The fifth fat would complete the round five path.
 	// Start is westernmost fat, so for 0 to 2 next fat is at south-east edge; and for 1 to 3 previous fat is at south-west edge.
@@ -213,7 +517,7 @@ static inline int8_t fillTypeB(Tiling * const tlngP, RhombId const rhId_Start)
 			if( nghbrP->touchesN )
 			{
 				// North
-				if( Fat == nghbrP->physique )  // Must touch thin
+				if( Fat == neighbour_physique(tlngP, nghbrP) )  // Must touch thin
 					return 0;
 
 				// North, thin
@@ -244,7 +548,7 @@ static inline int8_t fillTypeB(Tiling * const tlngP, RhombId const rhId_Start)
 			else
 			{
 				// S
-				if( Fat != nghbrP->physique )  // Must touch fat
+				if( Fat != neighbour_physique(tlngP, nghbrP) )  // Must touch fat
 					return 0;
 				if( nghbrP->touchesE )
 				{
@@ -271,6 +575,19 @@ static inline int8_t fillTypeB(Tiling * const tlngP, RhombId const rhId_Start)
 	if( thin_0 < 0  ||  thin_3 < 0 )  // Should be redundant
 		return 0;
 
+#if ExactCoordinates
+	for( fatNum = 1  ;  fatNum < 4  ;  fatNum ++ )
+		if( ! vertices_same(tlngP,  &(tlngP->rhombi[rhIds[0]]), south,  &(tlngP->rhombi[rhIds[fatNum]]), south) )
+			return 0;
+
+	RhombId const rhId_new = rhombus_append_exact(
+		tlngP,
+		Fat,
+		'B' + 1 - 'A',  // filledType
+		rhombus_eastExact(&(tlngP->rhombi[thin_0])),  // Same as thin_3's west
+		rhombus_southExact(&(tlngP->rhombi[rhIds[0]]))
+	);
+#else
 	if( points_different_4(tlngP,
 		tlngP->rhombi[rhIds[0]].south,
 		tlngP->rhombi[rhIds[1]].south,
@@ -298,20 +615,15 @@ static inline int8_t fillTypeB(Tiling * const tlngP, RhombId const rhId_Start)
 			tlngP->rhombi[rhIds[3]].south.y
 		)
 	);
+#endif
 	if( rhId_new < 0 )
 		return 0;
-
-	twoRhombi_Neighbourify(tlngP, rhId_new, rhIds[0]);
-	twoRhombi_Neighbourify(tlngP, rhId_new, rhIds[3]);
-	twoRhombi_Neighbourify(tlngP, rhId_new, thin_0);
-	twoRhombi_Neighbourify(tlngP, rhId_new, thin_3);
-
-	return 1;
+	return holesFilling_link(tlngP,  hfP,  rhId_new);
 }  // fillTypeB()
 
 
 
-static inline int8_t fillTypeC(Tiling * const tlngP, RhombId const rhId_Orig)
+static inline int8_t fillTypeC(Tiling * const tlngP,  HolesFilling * const hfP,  RhombId const rhId_Orig)
 {
 	// Fat has three neighbours: two thins at south; north being one fat and one nothing.
 	// Missing neighbour must be a fat, its north vertex being original's north vertex.
@@ -332,7 +644,7 @@ static inline int8_t fillTypeC(Tiling * const tlngP, RhombId const rhId_Orig)
 		if( nghbrP->touchesN )
 		{
 			// North
-			if( Fat == nghbrP->physique )
+			if( Fat == neighbour_physique(tlngP, nghbrP) )
 			{
 				if( rhId_Next >= 0 )  // This is second fat, which is disallowed
 					return 0;
@@ -345,7 +657,7 @@ static inline int8_t fillTypeC(Tiling * const tlngP, RhombId const rhId_Orig)
 		else
 		{
 			// South
-			if( Thin == nghbrP->physique )
+			if( Thin == neighbour_physique(tlngP, nghbrP) )
 				numThins ++;
 			else
 				return 0;  // Southerly fats disallowed.
@@ -357,7 +669,7 @@ static inline int8_t fillTypeC(Tiling * const tlngP, RhombId const rhId_Orig)
 	short int totalAngle;
 	RhombId rhId_Prev, rhId_This = rhId_Orig;
 	bool foundNext;
-	XY const xyOrigNorth = tlngP->rhombi[rhId_Orig].north;
+	Rhombus const * const rhP_Orig = &(tlngP->rhombi[rhId_Orig]);
 
 	for( totalAngle = 0  ;  totalAngle < 144  ;  totalAngle += tlngP->rhombi[rhId_This].physique )
 	{
@@ -371,9 +683,9 @@ static inline int8_t fillTypeC(Tiling * const tlngP, RhombId const rhId_Orig)
 			rhId_Next = nghbrP->rhId;
 			if( rhId_Next == rhId_Prev )
 				continue;  // next nghbrNum
-			if( nghbrP->physique == Fat )
+			if( neighbour_physique(tlngP, nghbrP) == Fat )
 			{
-				if( points_same_2(tlngP,  xyOrigNorth,  tlngP->rhombi[rhId_Next].north) )
+				if( vertices_same(tlngP,  rhP_Orig, north,  &(tlngP->rhombi[rhId_Next]), north) )
 				{
 					foundNext = true;
 					break;
@@ -382,8 +694,8 @@ static inline int8_t fillTypeC(Tiling * const tlngP, RhombId const rhId_Orig)
 			else
 			{
 				// Thin
-				if( points_same_2(tlngP,  xyOrigNorth,  tlngP->rhombi[rhId_Next].east)
-				||  points_same_2(tlngP,  xyOrigNorth,  tlngP->rhombi[rhId_Next].west) )
+				if( vertices_same(tlngP,  rhP_Orig, north,  &(tlngP->rhombi[rhId_Next]), east)
+				||  vertices_same(tlngP,  rhP_Orig, north,  &(tlngP->rhombi[rhId_Next]), west) )
 				{
 					foundNext = true;
 					break;
@@ -397,6 +709,20 @@ static inline int8_t fillTypeC(Tiling * const tlngP, RhombId const rhId_Orig)
 	if( Fat != tlngP->rhombi[rhId_Next].physique  ||  totalAngle != 144 )  // Required qualities
 		return 0;
 
+#if ExactCoordinates
+	RhombId const rhId_new = rhombus_append_exact(
+		tlngP,
+		Fat,
+		'C' + 1 - 'A',  // filledType
+		rhombus_northExact(rhP_Orig),
+		lattice_subtract(
+			(OrigsNghbrTouchesE
+				? lattice_add(rhombus_westExact(rhP_Orig),  rhombus_eastExact(&(tlngP->rhombi[rhId_Next])))
+				: lattice_add(rhombus_eastExact(rhP_Orig),  rhombus_westExact(&(tlngP->rhombi[rhId_Next])))),
+			rhombus_northExact(rhP_Orig)
+		)
+	);
+#else
 	double const new_N_x = avg_2( tlngP->rhombi[rhId_Orig].north.x,  tlngP->rhombi[rhId_Next].north.x);  // Better precision might use all five points.
 	double const new_N_y = avg_2( tlngP->rhombi[rhId_Orig].north.y,  tlngP->rhombi[rhId_Next].north.y);
 
@@ -413,24 +739,19 @@ static inline int8_t fillTypeC(Tiling * const tlngP, RhombId const rhId_Orig)
 			? tlngP->rhombi[rhId_Orig].west.y + tlngP->rhombi[rhId_Next].east.y
 			: tlngP->rhombi[rhId_Orig].east.y + tlngP->rhombi[rhId_Next].west.y) - new_N_y
 	);
+#endif
 	if( rhId_new < 0 )
 		return 0;
-
-	twoRhombi_Neighbourify(tlngP,  rhId_new,  rhId_Orig);
-	twoRhombi_Neighbourify(tlngP,  rhId_new,  rhId_Next);
-	oneRhombi_Neighbourify(tlngP,  rhId_new,  0,                    rhId_lastSorted,                       true );
-	oneRhombi_Neighbourify(tlngP,  rhId_new,  rhId_lastSorted + 1,  tlngP->numFats + tlngP->numThins - 1,  false);
-
-	return 1;
+	return holesFilling_link(tlngP,  hfP,  rhId_new);
 }  // fillTypeC()
 
 
-static inline int8_t fillTypeD(Tiling * const tlngP, RhombId const rhId_Thin1)
+static inline int8_t fillTypeD(Tiling * const tlngP,  HolesFilling * const hfP,  RhombId const rhId_Thin1)
 {
 	// Two neighbouring thins must meet at their south vertex.
 	// Also touching their south vertex must be the south vertex of a fat.
 	// If missing, insert.
-	// But subsequent neighbourification is difficult, so instead whole tiling reneighbourified.
+	// Subsequent neighbourification is by holesFilling_link(), finding all the new rhombus's neighbours.
 
 	if( Thin != tlngP->rhombi[rhId_Thin1].physique  ||  tlngP->rhombi[rhId_Thin1].numNeighbours == 4 )
 		return 0;
@@ -446,7 +767,7 @@ static inline int8_t fillTypeD(Tiling * const tlngP, RhombId const rhId_Thin1)
 		if( ! nghbrP->touchesN )
 		{
 			// South
-			if( Thin == nghbrP->physique )
+			if( Thin == neighbour_physique(tlngP, nghbrP) )
 			{
 				rhId_Thin2 = nghbrP->rhId;
 				touch1East = nghbrP->touchesE;
@@ -459,6 +780,20 @@ static inline int8_t fillTypeD(Tiling * const tlngP, RhombId const rhId_Thin1)
 	if( rhId_Thin2 < 0 )
 		return 0;
 
+#if ExactCoordinates
+	RhombId const rhId_new = rhombus_append_exact(
+		tlngP,
+		Fat,
+		'D' + 1 - 'A',  // filledType
+		lattice_subtract(
+			(touch1East
+				? lattice_add(rhombus_westExact(&(tlngP->rhombi[rhId_Thin1])),  rhombus_eastExact(&(tlngP->rhombi[rhId_Thin2])))
+				: lattice_add(rhombus_eastExact(&(tlngP->rhombi[rhId_Thin1])),  rhombus_westExact(&(tlngP->rhombi[rhId_Thin2])))),
+			rhombus_southExact(&(tlngP->rhombi[rhId_Thin1]))
+		),
+		rhombus_southExact(&(tlngP->rhombi[rhId_Thin1]))
+	);
+#else
 	double const new_south_x = avg_2(tlngP->rhombi[rhId_Thin1].south.x, tlngP->rhombi[rhId_Thin2].south.x);
 	double const new_south_y = avg_2(tlngP->rhombi[rhId_Thin1].south.y, tlngP->rhombi[rhId_Thin2].south.y);
 
@@ -481,27 +816,23 @@ static inline int8_t fillTypeD(Tiling * const tlngP, RhombId const rhId_Thin1)
 		new_south_x,
 		new_south_y
 	);
+#endif
 	if( rhId_new < 0 )
 		return 0;
-	twoRhombi_Neighbourify(tlngP,  rhId_new,  rhId_Thin1);
-	twoRhombi_Neighbourify(tlngP,  rhId_new,  rhId_Thin2);
-	oneRhombi_Neighbourify(tlngP,  rhId_new,  0,                    rhId_lastSorted,                       true );
-	oneRhombi_Neighbourify(tlngP,  rhId_new,  rhId_lastSorted + 1,  tlngP->numFats + tlngP->numThins - 1,  false);
-
-	return 1;
+	return holesFilling_link(tlngP,  hfP,  rhId_new);
 }  // fillTypeD()
 
 
-static inline int8_t fillTypeE(Tiling * const tlngP, RhombId const rhId_Start)
+static inline int8_t fillTypeE(Tiling * const tlngP,  HolesFilling * const hfP,  RhombId const rhId_Start)
 {
 	// Five fats, sharing their south vertex, so this is a round 5-path, which is travelled eastwards.
 	// Should be surrounded by 5 thins, fat NE touching thin NE, and fat NW touching thin NW.
-	// But subsequent neighbourification is difficult, so instead whole tiling reneighbourified.
+	// Subsequent neighbourification is by holesFilling_link(), finding all the new rhombus's neighbours.
 
 	if( Fat != tlngP->rhombi[rhId_Start].physique
 	||  tlngP->rhombi[rhId_Start].numNeighbours <= 1
-	||  tlngP->rhombi[rhId_Start].north.x <= tlngP->rhombi[rhId_Start].south.x
-	||  tlngP->rhombi[rhId_Start].north.y <= tlngP->rhombi[rhId_Start].south.y )  // Orientation constraint prevents repeating same loop multiple times
+	||  rhombus_north(tlngP, &(tlngP->rhombi[rhId_Start])).x <= rhombus_south(tlngP, &(tlngP->rhombi[rhId_Start])).x
+	||  rhombus_north(tlngP, &(tlngP->rhombi[rhId_Start])).y <= rhombus_south(tlngP, &(tlngP->rhombi[rhId_Start])).y )  // Orientation constraint prevents repeating same loop multiple times
 		return 0;
 
 	int8_t nghbrNum, fatNum, fatNumNext;
@@ -516,7 +847,7 @@ static inline int8_t fillTypeE(Tiling * const tlngP, RhombId const rhId_Start)
 		if( rhIds[fatNum] < 0
 		||  Fat != tlngP->rhombi[rhIds[fatNum]].physique
 		||  tlngP->rhombi[rhIds[fatNum]].numNeighbours <= 1
-		||  ( fatNum > 0  &&  points_different_2(tlngP, tlngP->rhombi[rhId_Start].south, tlngP->rhombi[rhIds[fatNum]].south) )  )
+		||  ( fatNum > 0  &&  ! vertices_same(tlngP,  &(tlngP->rhombi[rhId_Start]), south,  &(tlngP->rhombi[rhIds[fatNum]]), south) )  )
 			return 0;
 
 		thin_NE[fatNum] = false;
@@ -529,7 +860,7 @@ static inline int8_t fillTypeE(Tiling * const tlngP, RhombId const rhId_Start)
 			if( nghbrP->touchesN )
 			{
 				// North
-				if( Fat == nghbrP->physique )  // Cannot neighbour fat
+				if( Fat == neighbour_physique(tlngP, nghbrP) )  // Cannot neighbour fat
 					return 0;
 
 				// North, thin
@@ -541,7 +872,7 @@ static inline int8_t fillTypeE(Tiling * const tlngP, RhombId const rhId_Start)
 			else
 			{
 				// South
-				if( Fat != nghbrP->physique )  // Must touch fat
+				if( Fat != neighbour_physique(tlngP, nghbrP) )  // Must touch fat
 					return 0;
 
 				if( nghbrP->touchesE )
@@ -573,7 +904,9 @@ static inline int8_t fillTypeE(Tiling * const tlngP, RhombId const rhId_Start)
 	if( allFiveThinsPresent )
 		return 0;
 
+#if ! ExactCoordinates
 	double new_x, new_y;
+#endif
 
 	int8_t numInserted = 0;
 
@@ -582,6 +915,18 @@ static inline int8_t fillTypeE(Tiling * const tlngP, RhombId const rhId_Start)
 		fatNumNext = (fatNum + 1) % 5;
 		if( !thin_NE[fatNum]  &&  !thin_NW[fatNumNext] )
 		{
+#if ExactCoordinates
+			RhombId const rhId_new = rhombus_append_exact(
+				tlngP,
+				Thin,
+				'E' + 1 - 'A',  // filledType
+				rhombus_eastExact(&(tlngP->rhombi[rhIds[fatNum]])),  // Same as next's west
+				lattice_subtract(
+					lattice_add(rhombus_northExact(&(tlngP->rhombi[rhIds[fatNum]])),  rhombus_northExact(&(tlngP->rhombi[rhIds[fatNumNext]]))),
+					rhombus_eastExact(&(tlngP->rhombi[rhIds[fatNum]]))
+				)
+			);
+#else
 			new_x = avg_2( tlngP->rhombi[rhIds[fatNum]].east.x,  tlngP->rhombi[rhIds[fatNumNext]].west.x );
 			new_y = avg_2( tlngP->rhombi[rhIds[fatNum]].east.y,  tlngP->rhombi[rhIds[fatNumNext]].west.y );
 			RhombId const rhId_new = rhombus_append(
@@ -593,17 +938,9 @@ static inline int8_t fillTypeE(Tiling * const tlngP, RhombId const rhId_Start)
 				tlngP->rhombi[rhIds[fatNum]].north.x + tlngP->rhombi[rhIds[fatNumNext]].north.x - new_x,
 				tlngP->rhombi[rhIds[fatNum]].north.y + tlngP->rhombi[rhIds[fatNumNext]].north.y - new_y
 			);
+#endif
 			if( rhId_new >= 0 )
-			{
-				numInserted ++;
-				twoRhombi_Neighbourify(tlngP, rhId_new, rhIds[fatNum    ]);
-				twoRhombi_Neighbourify(tlngP, rhId_new, rhIds[fatNumNext]);
-
-				oneRhombi_Neighbourify(tlngP,  fatNum    ,  0,  rhId_lastSorted,  true);
-				oneRhombi_Neighbourify(tlngP,  fatNumNext,  0,  rhId_lastSorted,  true);
-				oneRhombi_Neighbourify(tlngP,  fatNum    ,  rhId_lastSorted + 1,  tlngP->numFats + tlngP->numThins - 1,  false);
-				oneRhombi_Neighbourify(tlngP,  fatNumNext,  rhId_lastSorted + 1,  tlngP->numFats + tlngP->numThins - 1,  false);
-			} // if( rhId_new >= 0 )
+				numInserted += holesFilling_link(tlngP,  hfP,  rhId_new);
 		}  // !thin...
 	}  // for( fatNum ... )
 	return numInserted;
@@ -611,7 +948,7 @@ static inline int8_t fillTypeE(Tiling * const tlngP, RhombId const rhId_Start)
 
 
 
-static inline int8_t fillTypeF(Tiling * const tlngP, RhombId const rhId_Start)
+static inline int8_t fillTypeF(Tiling * const tlngP,  HolesFilling * const hfP,  RhombId const rhId_Start)
 {
 	// Start with a fat with <=3 neighbours, and no north-west neighbour.
 	// Traverse around the original fat's north vertex. Could be traversing in either direction.
@@ -620,12 +957,12 @@ static inline int8_t fillTypeF(Tiling * const tlngP, RhombId const rhId_Start)
 	// Count number thins with east matching original north, num thins with west matching original's north.
 	// Score 36 for a thin, 72 for a fat. If total is 324, then missing just a thin.
 	// New thin has the east or west matching original north according to which is one fewer.
-	// But subsequent neighbourification is difficult, so instead whole tiling reneighbourified.
+	// Subsequent neighbourification is by holesFilling_link(), finding all the new rhombus's neighbours.
 
 	if( Fat != tlngP->rhombi[rhId_Start].physique  ||  tlngP->rhombi[rhId_Start].numNeighbours == 4 )
 		return 0;
 
-	XY const origNorth = tlngP->rhombi[rhId_Start].north;
+	Rhombus const * const rhP_Start = &(tlngP->rhombi[rhId_Start]);
 	short int physiqueTotal = 0;
 	int8_t nghbrNum, numThinsMatchingEast = 0, numThinsMatchingWest = 0;
 	RhombId rhId_Prev,  rhId_This = - 1,  rhId_Next = rhId_Start;
@@ -651,7 +988,7 @@ static inline int8_t fillTypeF(Tiling * const tlngP, RhombId const rhId_Start)
 				if( Fat == tlngP->rhombi[rhId_Next].physique )
 				{
 					// Fat
-					if( points_same_2(tlngP, origNorth, tlngP->rhombi[rhId_Next].north) )
+					if( vertices_same(tlngP,  rhP_Start, north,  &(tlngP->rhombi[rhId_Next]), north) )
 					{
 						thereIsGoodNghbr = true;
 						break;  // for( nghbrNum ... )
@@ -660,13 +997,13 @@ static inline int8_t fillTypeF(Tiling * const tlngP, RhombId const rhId_Start)
 				else
 				{
 					// Thin
-					if( points_same_2(tlngP, origNorth, tlngP->rhombi[rhId_Next].east) )
+					if( vertices_same(tlngP,  rhP_Start, north,  &(tlngP->rhombi[rhId_Next]), east) )
 					{
 						numThinsMatchingEast ++;
 						thereIsGoodNghbr = true;
 						break;  // for( nghbrNum ... )
 					}  // orig north == this east
-					if( points_same_2(tlngP, origNorth, tlngP->rhombi[rhId_Next].west) )
+					if( vertices_same(tlngP,  rhP_Start, north,  &(tlngP->rhombi[rhId_Next]), west) )
 					{
 						numThinsMatchingWest ++;
 						thereIsGoodNghbr = true;
@@ -696,6 +1033,15 @@ static inline int8_t fillTypeF(Tiling * const tlngP, RhombId const rhId_Start)
 		exit(EXIT_FAILURE);
 	}  // Two impossibilities
 
+#if ExactCoordinates
+	RhombId const rhId_new = rhombus_append_exact(
+		tlngP,
+		Thin,
+		'F' + 1 - 'A',  // filledType
+		numThinsMatchingEast > numThinsMatchingWest  ?  rhombus_westExact(rhP_Start)  :  rhombus_eastExact(rhP_Start),
+		rhombus_southExact(&(tlngP->rhombi[rhId_This]))
+	);
+#else
 	RhombId const rhId_new = rhombus_append(
 		tlngP,
 		Thin,
@@ -705,23 +1051,18 @@ static inline int8_t fillTypeF(Tiling * const tlngP, RhombId const rhId_Start)
 		tlngP->rhombi[rhId_This].south.x,
 		tlngP->rhombi[rhId_This].south.y
 	);
+#endif
 	if( rhId_new < 0 )
 		return 0;
-
-	twoRhombi_Neighbourify(tlngP,  rhId_new,  rhId_Start);
-	twoRhombi_Neighbourify(tlngP,  rhId_new,  rhId_This );
-	oneRhombi_Neighbourify(tlngP,  rhId_new,  0,                    rhId_lastSorted,                       true );
-	oneRhombi_Neighbourify(tlngP,  rhId_new,  rhId_lastSorted + 1,  tlngP->numFats + tlngP->numThins - 1,  false);
-
-	return 1;
+	return holesFilling_link(tlngP,  hfP,  rhId_new);
 }  // fillTypeF()
 
 
 
-static inline int8_t fillTypeG(Tiling * const tlngP, RhombId const rhId_Orig)
+static inline int8_t fillTypeG(Tiling * const tlngP,  HolesFilling * const hfP,  RhombId const rhId_Orig)
 {
 	// For every thin, both north edges touch fats that touch each other. Fats' norths touch thin; fats' souths share a vertex.
-	// But subsequent neighbourification is difficult, so instead whole tiling reneighbourified.
+	// Subsequent neighbourification is by holesFilling_link(), finding all the new rhombus's neighbours.
 
 	if( Thin != tlngP->rhombi[rhId_Orig].physique  ||  tlngP->rhombi[rhId_Orig].numNeighbours == 4 )  // Required qualities
 		return 0;
@@ -736,7 +1077,7 @@ static inline int8_t fillTypeG(Tiling * const tlngP, RhombId const rhId_Orig)
 		nghbrP = &(tlngP->rhombi[rhId_Orig].neighbours[nghbrNum]);
 		if( nghbrP->touchesN )
 		{
-			if( Fat == nghbrP->physique )
+			if( Fat == neighbour_physique(tlngP, nghbrP) )
 			{
 				if( nghbrP->touchesE )
 					rhId_E = nghbrP->rhId;
@@ -760,16 +1101,33 @@ static inline int8_t fillTypeG(Tiling * const tlngP, RhombId const rhId_Orig)
 /*
 	printf("fillTypeG(), tilingId=%02" PRIi8 ",  CentreX=%0.4lf,  CentreY=%0.4lf,  rhId_Orig=%li,  rhId_E=%li,  rhId_W=%li\n",
 		tlngP->tilingId,
-		(tlngP->rhombi[rhId_Orig].north.x + tlngP->rhombi[rhId_Orig].south.x) / 2,
-		(tlngP->rhombi[rhId_Orig].north.y + tlngP->rhombi[rhId_Orig].south.y) / 2,
+		(rhombus_north(tlngP, &(tlngP->rhombi[rhId_Orig])).x + rhombus_south(tlngP, &(tlngP->rhombi[rhId_Orig])).x) / 2,
+		(rhombus_north(tlngP, &(tlngP->rhombi[rhId_Orig])).y + rhombus_south(tlngP, &(tlngP->rhombi[rhId_Orig])).y) / 2,
 		rhId_Orig, rhId_E, rhId_W
 	);
 */
+#if ExactCoordinates
+	// north * GoldenRatioSquare - south * GoldenRatio = north + (north - south) * GoldenRatio
+	Lattice const newExact = lattice_add(
+		rhombus_northExact(&(tlngP->rhombi[rhId_Orig])),
+		lattice_timesGoldenRatio( lattice_subtract(rhombus_northExact(&(tlngP->rhombi[rhId_Orig])),  rhombus_southExact(&(tlngP->rhombi[rhId_Orig]))) )
+	);
+#else
 	double const new_x = tlngP->rhombi[rhId_Orig].north.x * GoldenRatioSquare  -  GoldenRatio * tlngP->rhombi[rhId_Orig].south.x;
 	double const new_y = tlngP->rhombi[rhId_Orig].north.y * GoldenRatioSquare  -  GoldenRatio * tlngP->rhombi[rhId_Orig].south.y;
+#endif
 
 	if( rhId_E < 0 )
 	{
+#if ExactCoordinates
+		rhId_E = rhombus_append_exact(
+			tlngP,
+			Fat,
+			'G' + 1 - 'A',  // filledType
+			rhombus_eastExact(&(tlngP->rhombi[rhId_Orig])),
+			newExact
+		);
+#else
 		rhId_E = rhombus_append(
 			tlngP,
 			Fat,
@@ -779,17 +1137,22 @@ static inline int8_t fillTypeG(Tiling * const tlngP, RhombId const rhId_Orig)
 			new_x,
 			new_y
 		);
+#endif
 		if( rhId_E >= 0 )
-		{
-			numInserted ++;
-			twoRhombi_Neighbourify(tlngP,  rhId_E,  rhId_Orig);
-			oneRhombi_Neighbourify(tlngP,  rhId_E,  0,  rhId_lastSorted,  true);
-			oneRhombi_Neighbourify(tlngP,  rhId_E,  rhId_lastSorted + 1,  tlngP->numFats + tlngP->numThins - 1,  false);
-		}  // if( rhId_E >= 0 )
+			numInserted += holesFilling_link(tlngP,  hfP,  rhId_E);
 	}  // if( rhId_E < 0 )
 
 	if( rhId_W < 0 )
 	{
+#if ExactCoordinates
+		rhId_W = rhombus_append_exact(
+			tlngP,
+			Fat,
+			'G' + 1 - 'A',  // filledType
+			rhombus_westExact(&(tlngP->rhombi[rhId_Orig])),
+			newExact
+		);
+#else
 		rhId_W = rhombus_append(
 			tlngP,
 			Fat,
@@ -799,15 +1162,9 @@ static inline int8_t fillTypeG(Tiling * const tlngP, RhombId const rhId_Orig)
 			new_x,
 			new_y
 		);
+#endif
 		if( rhId_W >= 0 )
-		{
-			numInserted ++;
-			twoRhombi_Neighbourify(tlngP, rhId_W, rhId_Orig);
-			if( rhId_E >= 0 )
-				twoRhombi_Neighbourify(tlngP,  rhId_W,  rhId_E);
-			oneRhombi_Neighbourify(tlngP,  rhId_W,  0,  rhId_lastSorted,  true);
-			oneRhombi_Neighbourify(tlngP,  rhId_W,  rhId_lastSorted + 1,  tlngP->numFats + tlngP->numThins - 1,  false);
-		}  // if( rhId_W >= 0 )
+			numInserted += holesFilling_link(tlngP,  hfP,  rhId_W);
 	}  // if( rhId_W < 0 )
 
 	return numInserted;
@@ -816,131 +1173,614 @@ static inline int8_t fillTypeG(Tiling * const tlngP, RhombId const rhId_Orig)
 
 
 
-void holesFill(Tiling * const tlngP)
+static int8_t (* const holesFill_fillTypes[HolesFilling_NumFillTypes])(Tiling * const,  HolesFilling * const,  RhombId const) =
+	{fillTypeA, fillTypeB, fillTypeC, fillTypeD, fillTypeE, fillTypeF, fillTypeG};
+
+
+
+
+// Each fillType on each queued rhombus, each fillType emptying its queue before the next, until all are empty.
+static void holesFill_byWorklist(Tiling * const tlngP,  HolesFilling * const hfP,  uint8_t const * const signatureTable,  long int * const numFilled)
 {
-	RhombId rhId; 
-	long int numFilledTypeA = 0, numFilledTypeB = 0, numFilledTypeC = 0, numFilledTypeD = 0, numFilledTypeE = 0, numFilledTypeF = 0, numFilledTypeG = 0;
-	bool anyChanges, anyChangesThisType;
-	int8_t numInserted;
-	const bool debug_holesFill = false;
+	RhombId rhId;
+	int8_t fillNum;
+	bool anyQueued;
+
+	for( fillNum = 0  ;  fillNum < HolesFilling_NumFillTypes  ;  fillNum ++ )
+	{
+		hfP->queues_NumMax[fillNum] = 1024;
+		hfP->queues[fillNum] = malloc( hfP->queues_NumMax[fillNum] * sizeof(RhombId) );
+		if( NULL == hfP->queues[fillNum] )
+		{
+			fprintf(stderr, "holesFill_byWorklist(): !!! NULL == queues[%i] !!!\n", fillNum);
+			fflush(stderr);
+			exit(EXIT_FAILURE);
+		}
+		hfP->queueHeads[fillNum] = hfP->queueEnds[fillNum] = 0;
+	}  // for( fillNum ... )
+	hfP->queued_NumMax = 0;
+	hfP->queued = NULL;
+
+	for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+		if( tlngP->rhombi[rhId].numNeighbours < 4 )
+			holesFilling_enqueueNear(tlngP,  hfP,  rhId);
 
-	rhId_lastSorted = tlngP->numFats + tlngP->numThins;
+	do {
+		anyQueued = false;
+		for( fillNum = 0  ;  fillNum < HolesFilling_NumFillTypes  ;  fillNum ++ )
+			while( hfP->queueHeads[fillNum] < hfP->queueEnds[fillNum] )
+			{
+				anyQueued = true;
+				rhId = hfP->queues[fillNum][ hfP->queueHeads[fillNum] ++ ];
+				hfP->queued[rhId] &= ~(1 << fillNum);
+				if( signatureTable[ hfP->signatures[rhId] ]  &  (1 << fillNum) )
+					numFilled[fillNum] += holesFill_fillTypes[fillNum](tlngP,  hfP,  rhId);
+			}  // while( hfP->queueHeads[fillNum] < hfP->queueEnds[fillNum] )
+	} while( anyQueued );
+
+	for( fillNum = 0  ;  fillNum < HolesFilling_NumFillTypes  ;  fillNum ++ )
+		free(hfP->queues[fillNum]);
+	free(hfP->queued);
+}  // holesFill_byWorklist()
+
+
+// Each fillType on every rhombus, repeated until nothing changes.
+static void holesFill_bySweeps(Tiling * const tlngP,  HolesFilling * const hfP,  uint8_t const * const signatureTable,  long int * const numFilled)
+{
+	RhombId rhId;
+	long int numFilledThisType;
+	int8_t fillNum;
+	bool anyChanges;
 
 	do {
 		anyChanges = false;
+		for( fillNum = 0  ;  fillNum < HolesFilling_NumFillTypes  ;  fillNum ++ )
+		{
+			numFilledThisType = 0;
+			for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+				if( signatureTable[ hfP->signatures[rhId] ]  &  (1 << fillNum) )
+					numFilledThisType += holesFill_fillTypes[fillNum](tlngP,  hfP,  rhId);
+			if( numFilledThisType > 0 )
+			{
+				anyChanges = true;
+				numFilled[fillNum] += numFilledThisType;
+				printf("holesFill(), %c: tilingId=%" PRIi8 ", numFilledType%c = %li\n", 'A' + fillNum, tlngP->tilingId, 'A' + fillNum, numFilled[fillNum]);
+			}  // if( numFilledThisType > 0 )
+		}  // for( fillNum ... )
+	} while(anyChanges);
+}  // holesFill_bySweeps()
 
 
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  +A\n", tlngP->tilingId);
-		anyChangesThisType = false;
-		for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
-		{
-			numInserted = fillTypeA(tlngP, rhId);
-			if( numInserted > 0 )
-				{numFilledTypeA += numInserted;  anyChanges = anyChangesThisType = true;}
-		}  // for( rhId ... )
-		if( anyChangesThisType )
-			printf("holesFill(), A: tilingId=%" PRIi8 ", numFilledTypeA = %li\n", tlngP->tilingId, numFilledTypeA);
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  -A\n", tlngP->tilingId);
 
 
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  +B\n", tlngP->tilingId);
-		anyChangesThisType = false;
-		for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
-		{
-			numInserted = fillTypeB(tlngP, rhId);
-			if( numInserted > 0 )
-				{numFilledTypeB += numInserted;  anyChanges = anyChangesThisType = true;}
-		}  // for( rhId ... )
-		if( anyChangesThisType )
-			printf("holesFill(), B: tilingId=%" PRIi8 ", numFilledTypeB = %li\n", tlngP->tilingId, numFilledTypeB);
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  -B\n", tlngP->tilingId);
+// The open edges of all rhombi lacking a neighbour, every gap being against them; and every rhombus's signature. The open edges
+// being only around the edge of the tiling, the hash is sized to them, not to the whole tiling; it grows as rhombi are appended.
+static void holesFilling_init(Tiling const * const tlngP,  HolesFilling * const hfP,  bool const byWorklist,  SpatialHash const * const cutsP)
+{
+	RhombId rhId;
+	long int numOpenEdges = 0;
+
+	for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+		numOpenEdges += 4 - tlngP->rhombi[rhId].numNeighbours;
+	spatialHash_init(&(hfP->openEdges),  2 * 0.01 * tlngP->edgeLength,  numOpenEdges);
+	for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+		if( tlngP->rhombi[rhId].numNeighbours < 4 )
+			neighbours_openEdges_insert(tlngP,  &(hfP->openEdges),  rhId);
+
+	hfP->signatures_NumMax = 0;
+	hfP->signatures = NULL;
+	for( rhId = tlngP->numFats + tlngP->numThins - 1  ;  rhId >= 0  ;  rhId -- )  // Downwards, so one allocation.
+		holesFilling_signatureSet(tlngP,  hfP,  rhId);
+
+	hfP->byWorklist = byWorklist;
+	hfP->cuts = cutsP;
+	hfP->nearCut_NumMax = 0;
+	hfP->nearCut = NULL;
+}  // holesFilling_init()
+
+
+static void holesFilling_free(HolesFilling * const hfP)
+{
+	spatialHash_free(&(hfP->openEdges));
+	free(hfP->signatures);
+	hfP->signatures = NULL;
+	hfP->signatures_NumMax = 0;
+	free(hfP->nearCut);
+	hfP->nearCut = NULL;
+	hfP->nearCut_NumMax = 0;
+}  // holesFilling_free()
+
+
+// All the fills of tlngP, on this thread, adding to numFilled[]. cutsP as HolesFilling, and NULL unless by worklist.
+static void holesFill_serial(
+	Tiling            * const tlngP,
+	bool                const byWorklist,
+	uint8_t     const * const signatureTable,
+	SpatialHash const * const cutsP,
+	long int          * const numFilled
+)
+{
+	HolesFilling filling;
+
+	holesFilling_init(tlngP,  &filling,  byWorklist,  cutsP);
+	if( byWorklist )
+		holesFill_byWorklist(tlngP,  &filling,  signatureTable,  numFilled);
+	else
+		holesFill_bySweeps(tlngP,  &filling,  signatureTable,  numFilled);
+	holesFilling_free(&filling);
+}  // holesFill_serial()
 
 
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  +C\n", tlngP->tilingId);
-		anyChangesThisType = false;
-		for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+
+
+/*
+	By cells, as chosen by holesFillNumThreads(). Every fill is near the edge of the tiling, so needed is only the band of rhombi
+	within HolesFill_BandSteps steps, by neighbours, of one lacking a neighbour. This band is cut, at values of x, into vertical
+	cells, HolesFill_CellsPerThread per thread, done in waves of numThreads as descendants_append_parallel() in tilings.c.
+	Each cell is filled in its own patch: an arrays_Private tiling holding the band's rhombi within HolesFill_MarginEdges of the
+	cell, with only the neighbours also in the patch. Kept are the fills more than HolesFill_DeferEdges from the cell's borders.
+	Then, serially, each border is filled likewise, in a patch around it of the unfilled band, keeping the fills within
+	HolesFill_DeferEdges of it. The kept fills are appended to the tiling and linked, as if just made.
+
+	A rhombus cut from a neighbour by the patch, at the band's inner edge or at the patch's sides, would look to the rules like a
+	gap in the tiling, and be wrongly filled, starting chains of fills. So in a patch no rhombus within HolesFill_CutEdges of a cut
+	is ever queued; a rule reaching only HolesFilling_RadiusEdges, the others see what the serial worklist sees there. The cuts at
+	the band's inner edge are far from any fill, and those at the sides are in the margin, so the fills kept are those of serial,
+	with the same filledType. The patch's rhIds being in the tiling's order, neighbours stay in canonical order, and then
+	neighbours_canonical() puts the new rhombi where serial would. Checked by holesFillParallelVerifyQ().
+*/
+#define HolesFill_BandSteps      40
+#define HolesFill_CutEdges       6.0
+#define HolesFill_MarginEdges    24.0
+#define HolesFill_DeferEdges     2.0
+#define HolesFill_CellsPerThread 4
+
+typedef struct  // HolesFillPatch
+{
+	Tiling  const * tlngP;           // Not changed while patches are filled.
+	uint8_t const * signatureTable;
+	RhombId const * bandRhIds;       // Increasing.
+	long int        numBand;
+	double          xMin,      xMax;      // The patch is of the band's rhombi with centre.x in [xMin, xMax).
+	double          xKeepMin,  xKeepMax;  // Kept are the fills with centre.x in [xKeepMin, xKeepMax).
+	Rhombus       * kept;            // malloc()'d, with tlngP's neighbours yet to be found.
+	long int        numKept;
+} HolesFillPatch;
+
+
+static int holesFill_rhIdCompare(void const * const rhId0P,  void const * const rhId1P)
+{
+	RhombId const rhId0 = *(RhombId const *)rhId0P;
+	RhombId const rhId1 = *(RhombId const *)rhId1P;
+	return (rhId0 > rhId1) - (rhId0 < rhId1);
+}  // holesFill_rhIdCompare()
+
+
+// Appends rhId to band[], growing it if full.
+static void holesFill_bandAppend(RhombId ** const bandP,  long int * const numBandP,  long int * const band_NumMaxP,  RhombId const rhId)
+{
+	if( *numBandP >= *band_NumMaxP )
+	{
+		*band_NumMaxP = 2 * *band_NumMaxP + 1024;
+		*bandP = realloc( *bandP,  *band_NumMaxP * sizeof(RhombId) );
+		if( NULL == *bandP )
 		{
-			numInserted = fillTypeC(tlngP, rhId);
-			if( numInserted > 0 )
-				{numFilledTypeC += numInserted;  anyChanges = anyChangesThisType = true;}
-		}  // for( rhId ... )
-		if( anyChangesThisType )
-			printf("holesFill(), C: tilingId=%" PRIi8 ", numFilledTypeC = %li\n", tlngP->tilingId, numFilledTypeC);
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  -C\n", tlngP->tilingId);
+			fprintf(stderr, "holesFill_bandAppend(): !!! NULL == band, band_NumMax=%li !!!\n", *band_NumMaxP);
+			fflush(stderr);
+			exit(EXIT_FAILURE);
+		}
+	}  // Grow
+	(*bandP)[(*numBandP) ++] = rhId;
+}  // holesFill_bandAppend()
+
 
+// The rhombi within HolesFill_BandSteps steps of one lacking a neighbour, found breadth first. Returns their number, and sets
+// *bandRhIdsP to them, increasing, malloc()'d.
+static long int holesFill_band(Tiling const * const tlngP,  RhombId ** const bandRhIdsP)
+{
+	long int const numRhombi = tlngP->numFats + tlngP->numThins;
+	int8_t * const steps = malloc( (numRhombi > 0 ? numRhombi : 1) * sizeof(int8_t) );  // -1 ==> not in band
+	RhombId * band = NULL,  rhId,  rhId_Nghbr;
+	long int numBand = 0,  band_NumMax = 0,  bandNum;
+	int8_t nghbrNum;
 
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  +D\n", tlngP->tilingId);
-		anyChangesThisType = false;
-		for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+	if( NULL == steps )
+	{
+		fprintf(stderr, "holesFill_band(): !!! NULL == steps, numRhombi=%li !!!\n", numRhombi);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+	memset(steps,  -1,  numRhombi * sizeof(int8_t));
+
+	// First the rhombi lacking a neighbour, then breadth first, band[] being the queue.
+	for( rhId = 0  ;  rhId < numRhombi  ;  rhId ++ )
+		if( tlngP->rhombi[rhId].numNeighbours < 4 )
 		{
-			numInserted = fillTypeD(tlngP, rhId);
-			if( numInserted > 0 )
-				{numFilledTypeD += numInserted;  anyChanges = anyChangesThisType = true;}
-		}  // for( rhId ... )
-		if( anyChangesThisType )
+			steps[rhId] = 0;
+			holesFill_bandAppend(&band,  &numBand,  &band_NumMax,  rhId);
+		}
+	for( bandNum = 0  ;  bandNum < numBand  ;  bandNum ++ )
+	{
+		rhId = band[bandNum];
+		if( steps[rhId] >= HolesFill_BandSteps )
+			continue;
+		for( nghbrNum = 0  ;  nghbrNum < tlngP->rhombi[rhId].numNeighbours  ;  nghbrNum ++ )
 		{
-			printf("holesFill(), D: tilingId=%" PRIi8 ", numFilledTypeD = %li\n", tlngP->tilingId, numFilledTypeD);
-			neighbours_populate(tlngP);
-		}  // if( anyChangesThisType )
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  -D\n", tlngP->tilingId);
+			rhId_Nghbr = tlngP->rhombi[rhId].neighbours[nghbrNum].rhId;
+			if( steps[rhId_Nghbr] < 0 )
+			{
+				steps[rhId_Nghbr] = steps[rhId] + 1;
+				holesFill_bandAppend(&band,  &numBand,  &band_NumMax,  rhId_Nghbr);
+			}
+		}  // for( nghbrNum ... )
+	}  // for( bandNum ... )
+
+	// Increasing, without a sort.
+	for( rhId = 0,  bandNum = 0  ;  rhId < numRhombi  ;  rhId ++ )
+		if( steps[rhId] >= 0 )
+			band[bandNum ++] = rhId;
 
+	free(steps);
+	*bandRhIdsP = band;
+	return numBand;
+}  // holesFill_band()
 
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  +E\n", tlngP->tilingId);
-		anyChangesThisType = false;
-		for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+
+// Fills one patch, as described above, on whichever thread. Returns NULL, as needed by pthread_create().
+static void * holesFill_patch(void * const patchVoidP)
+{
+	HolesFillPatch * const ptchP = (HolesFillPatch *)patchVoidP;
+	Tiling const * const tlngP = ptchP->tlngP;
+	long int numFilled[HolesFilling_NumFillTypes] = {0};  // Unused: the kept fills are counted as they are linked into tlngP.
+	long int bandNum,  numPatch = 0;
+	RhombId * patchRhIds;  // Of tlngP, increasing, indexed by rhId in the patch.
+	RhombId const * found;
+	RhombId rhId,  rhId_Nghbr;
+	Rhombus * rhP;
+	SpatialHash cuts;  // Centres of the rhombi that lost a neighbour by not all of it being in the patch.
+	Tiling patch;
+	int8_t nghbrNum,  nghbrNumTo;
+	double x;
+
+	patchRhIds = malloc( (ptchP->numBand > 0 ? ptchP->numBand : 1) * sizeof(RhombId) );
+	if( NULL == patchRhIds )
+	{
+		fprintf(stderr, "holesFill_patch(): !!! NULL == patchRhIds, numBand=%li !!!\n", ptchP->numBand);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+	for( bandNum = 0  ;  bandNum < ptchP->numBand  ;  bandNum ++ )
+	{
+		x = rhombus_hotCentre(tlngP,  ptchP->bandRhIds[bandNum]).x;
+		if( x >= ptchP->xMin  &&  x < ptchP->xMax )
+			patchRhIds[numPatch ++] = ptchP->bandRhIds[bandNum];
+	}  // for( bandNum ... )
+
+	patch = *tlngP;  // Copies tilingId, edgeLength, Lattice, etc, as used by the fillTypes and rhombus_keep().
+	patch.numFats  = 0;
+	patch.numThins = 0;
+	patch.rhombi_Spatial = false;
+	patch.arrays_Private = true;  // So nothing mapped, file names being per tiling.
+	patch.rhombi_NumMax = numPatch  +  numPatch / 4  +  256;
+	patch.rhombi = bigArray_alloc(&patch,  patch.rhombi_NumMax,  sizeof(Rhombus),  "rhombi",  &(patch.rhombi_Mapped));
+#if HotArrays
+	patch.hot_NumMax = 0;
+	patch.hotCentres = NULL;
+	patch.hotBBoxes  = NULL;
+	patch.hotCentres_Mapped = false;
+	patch.hotBBoxes_Mapped  = false;
+#endif
+	if( NULL == patch.rhombi )
+	{
+		fprintf(stderr, "holesFill_patch(): !!! malloc() failure, numPatch=%li !!!\n", numPatch);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+
+	for( rhId = 0  ;  rhId < numPatch  ;  rhId ++ )
+	{
+		rhP = &(patch.rhombi[rhId]);
+		*rhP = tlngP->rhombi[ patchRhIds[rhId] ];
+		rhP->rhId = rhId;
+		// Neighbours outside the patch are dropped, their edges being open here. Order kept, so still canonical.
+		for( nghbrNum = 0,  nghbrNumTo = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum ++ )
 		{
-			numInserted = fillTypeE(tlngP, rhId);
-			if( numInserted > 0 )
-				{numFilledTypeE += numInserted;  anyChanges = anyChangesThisType = true;}
-		}  // for( rhId ... )
-		if( anyChangesThisType )
+			rhId_Nghbr = rhP->neighbours[nghbrNum].rhId;  // As a RhombId, the neighbour's field being narrower if CompactNeighbours.
+			found = bsearch( &rhId_Nghbr,  patchRhIds,  numPatch,  sizeof(RhombId),  &holesFill_rhIdCompare );
+			if( NULL == found )
+				continue;
+			rhP->neighbours[nghbrNumTo] = rhP->neighbours[nghbrNum];
+			rhP->neighbours[nghbrNumTo ++].rhId = found - patchRhIds;
+		}  // for( nghbrNum ... )
+		rhP->numNeighbours = nghbrNumTo;
+		for( nghbrNum = nghbrNumTo  ;  nghbrNum < 4  ;  nghbrNum ++ )
 		{
-			printf("holesFill(), E: tilingId=%" PRIi8 ", numFilledTypeE = %li\n", tlngP->tilingId, numFilledTypeE);
-			neighbours_populate(tlngP);
-		}  // if( anyChangesThisType )
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  -E\n", tlngP->tilingId);
+			rhP->neighbours[nghbrNum].rhId = -1;  // I.e., invalid
+			neighbour_nghbrsNghbrNum_set(rhP,  nghbrNum,  -1);  // I.e., invalid
+		}  // for( nghbrNum ... )
+		if( Fat == rhP->physique )
+			patch.numFats ++ ;
+		else
+			patch.numThins ++ ;
+	}  // for( rhId ... )
+	hotArrays_derive(&patch,  0,  numPatch);
+
+	// Pitch as spatialHash_candidates() returns every point within half of it, so holesFilling_nearCut() finds those within HolesFill_CutEdges.
+	spatialHash_init(&cuts,  2 * HolesFill_CutEdges * tlngP->edgeLength,  numPatch / 8);
+	for( rhId = 0  ;  rhId < numPatch  ;  rhId ++ )
+	{
+		neighbours_nghbrsNghbrNum_one(&patch,  rhId);
+		if( patch.rhombi[rhId].numNeighbours < tlngP->rhombi[ patchRhIds[rhId] ].numNeighbours )
+			spatialHash_insert(&cuts,  rhombus_hotCentre(&patch, rhId),  rhId);
+	}  // for( rhId ... )
+
+	holesFill_serial(&patch,  true,  ptchP->signatureTable,  &cuts,  numFilled);
+	spatialHash_free(&cuts);
 
+	ptchP->numKept = 0;
+	ptchP->kept = malloc( (patch.numFats + patch.numThins - numPatch > 0 ? patch.numFats + patch.numThins - numPatch : 1) * sizeof(Rhombus) );
+	if( NULL == ptchP->kept )
+	{
+		fprintf(stderr, "holesFill_patch(): !!! NULL == kept, numPatch=%li !!!\n", numPatch);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+	for( rhId = numPatch  ;  rhId < patch.numFats + patch.numThins  ;  rhId ++ )
+	{
+		x = rhombus_hotCentre(&patch,  rhId).x;
+		if( x >= ptchP->xKeepMin  &&  x < ptchP->xKeepMax )
+			ptchP->kept[ptchP->numKept ++] = patch.rhombi[rhId];
+	}  // for( rhId ... )
+
+	bigArray_free(patch.rhombi,  patch.rhombi_NumMax,  sizeof(Rhombus),  patch.rhombi_Mapped);
+	hotArrays_free(&patch);
+	free(patchRhIds);
+	return NULL;
+}  // holesFill_patch()
+
+
+// Parallel equivalent of holesFill_serial(tlngP, true, signatureTable, NULL, numFilled), as described above. Returns false, having
+// changed nothing, if the band is too narrow for two cells.
+static bool holesFill_byCells(
+	Tiling        * const tlngP,
+	uint8_t const * const signatureTable,
+	int             const numThreads,
+	long int      * const numFilled
+)
+{
+	double const margin = HolesFill_MarginEdges * tlngP->edgeLength;
+	double const defer  = HolesFill_DeferEdges  * tlngP->edgeLength;
+	RhombId * bandRhIds;
+	long int const numBand = holesFill_band(tlngP,  &bandRhIds);
+	long int numCells,  numPatches,  patchNum,  waveStart,  waveEnd,  keptNum,  bandNum;
+	double xMin = DBL_MAX,  xMax = -DBL_MAX,  xBorderLo,  xBorderHi;
+	HolesFillPatch *patches,  *ptchP;
+	HolesFilling filling;
+	pthread_t *threads;
+	bool *threadStarted;
+	RhombId rhId;
+	int8_t nghbrNum,  filledType;
+
+	for( bandNum = 0  ;  bandNum < numBand  ;  bandNum ++ )
+	{
+		if( xMin > rhombus_hotCentre(tlngP, bandRhIds[bandNum]).x )  xMin = rhombus_hotCentre(tlngP, bandRhIds[bandNum]).x;
+		if( xMax < rhombus_hotCentre(tlngP, bandRhIds[bandNum]).x )  xMax = rhombus_hotCentre(tlngP, bandRhIds[bandNum]).x;
+	}  // for( bandNum ... )
+
+	// Each cell at least two margins wide, so that most of a patch is kept.
+	for( numCells = (long int)numThreads * HolesFill_CellsPerThread  ;  numCells >= 2  &&  xMax - xMin < numCells * 2 * margin  ;  numCells -- )
+		;
+	if( numCells < 2 )
+	{
+		free(bandRhIds);
+		return false;
+	}
+	numPatches = 2 * numCells - 1;  // The cells, then the borders between them.
+
+	patches       = malloc( numPatches * sizeof(HolesFillPatch) );
+	threads       = malloc( numThreads * sizeof(pthread_t) );
+	threadStarted = malloc( numThreads * sizeof(bool) );
+	if( NULL == patches  ||  NULL == threads  ||  NULL == threadStarted )
+	{
+		fprintf(stderr, "holesFill_byCells(): !!! malloc() failure, numThreads=%i !!!\n", numThreads);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
 
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  +F\n", tlngP->tilingId);
-		anyChangesThisType = false;
-		for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+	for( patchNum = 0  ;  patchNum < numPatches  ;  patchNum ++ )
+	{
+		ptchP = &(patches[patchNum]);
+		ptchP->tlngP          = tlngP;
+		ptchP->signatureTable = signatureTable;
+		ptchP->bandRhIds      = bandRhIds;
+		ptchP->numBand        = numBand;
+		ptchP->kept           = NULL;
+		ptchP->numKept        = 0;
+		if( patchNum < numCells )
 		{
-			numInserted = fillTypeF(tlngP, rhId);
-			if( numInserted > 0 )
-				{numFilledTypeF += numInserted;  anyChanges = anyChangesThisType = true;}
-		}  // for( rhId ... )
-		if( anyChangesThisType )
+			// Outermost cells unbounded, so that every fill, wherever, is in exactly one cell or border.
+			xBorderLo = ( 0 == patchNum             ?  -DBL_MAX  :  xMin  +  (xMax - xMin) * patchNum       / numCells );
+			xBorderHi = ( patchNum + 1 == numCells  ?   DBL_MAX  :  xMin  +  (xMax - xMin) * (patchNum + 1) / numCells );
+			ptchP->xMin     = ( 0 == patchNum             ?  -DBL_MAX  :  xBorderLo - margin );
+			ptchP->xMax     = ( patchNum + 1 == numCells  ?   DBL_MAX  :  xBorderHi + margin );
+			ptchP->xKeepMin = ( 0 == patchNum             ?  -DBL_MAX  :  xBorderLo + defer );
+			ptchP->xKeepMax = ( patchNum + 1 == numCells  ?   DBL_MAX  :  xBorderHi - defer );
+		}
+		else
 		{
-			printf("holesFill(), F: tilingId=%" PRIi8 ", numFilledTypeF = %li\n", tlngP->tilingId, numFilledTypeF);
-			neighbours_populate(tlngP);
-		}  // if( anyChangesThisType )
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  -F\n", tlngP->tilingId);
+			xBorderLo = xMin  +  (xMax - xMin) * (patchNum + 1 - numCells) / numCells;  // Computed as the cells', so the same.
+			ptchP->xMin     = xBorderLo - defer - margin;
+			ptchP->xMax     = xBorderLo + defer + margin;
+			ptchP->xKeepMin = xBorderLo - defer;
+			ptchP->xKeepMax = xBorderLo + defer;
+		}
+	}  // for( patchNum ... )
 
+	// The cells, in waves of numThreads.
+	for( waveStart = 0  ;  waveStart < numCells  ;  waveStart = waveEnd )
+	{
+		waveEnd = waveStart + numThreads;
+		if( waveEnd > numCells )
+			waveEnd = numCells;
 
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  +G\n", tlngP->tilingId);
-		anyChangesThisType = false;
-		for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+		for( patchNum = waveStart  ;  patchNum < waveEnd  ;  patchNum ++ )
 		{
-			numInserted = fillTypeG(tlngP, rhId);
-			if( numInserted > 0 )
-				{numFilledTypeG += numInserted;  anyChanges = anyChangesThisType = true;}
-		}  // for( rhId ... )
-		if( anyChangesThisType )
+			threadStarted[patchNum - waveStart] = ( 0 == pthread_create(&(threads[patchNum - waveStart]), NULL, &holesFill_patch, &(patches[patchNum])) );
+			if( ! threadStarted[patchNum - waveStart] )
+				holesFill_patch(&(patches[patchNum]));  // Couldn't start a thread, so do it here.
+		}  // for( patchNum ... )
+
+		for( patchNum = waveStart  ;  patchNum < waveEnd  ;  patchNum ++ )
+			if( threadStarted[patchNum - waveStart] )
+				pthread_join(threads[patchNum - waveStart], NULL);
+	}  // for( waveStart ... )
+
+	// The deferred fills near the borders, serially.
+	for( patchNum = numCells  ;  patchNum < numPatches  ;  patchNum ++ )
+		holesFill_patch(&(patches[patchNum]));
+	free(bandRhIds);
+
+	// The kept fills, appended and linked as if just made by a fillType. Their order is undone by neighbours_canonical().
+	holesFilling_init(tlngP,  &filling,  false,  NULL);
+	for( patchNum = 0  ;  patchNum < numPatches  ;  patchNum ++ )
+	{
+		ptchP = &(patches[patchNum]);
+		for( keptNum = 0  ;  keptNum < ptchP->numKept  ;  keptNum ++ )
+		{
+			rhId = tlngP->numFats + tlngP->numThins;
+			rhombus_append_copy(tlngP,  &(ptchP->kept[keptNum]));
+			tlngP->rhombi[rhId].numNeighbours = 0;
+			for( nghbrNum = 0  ;  nghbrNum < 4  ;  nghbrNum ++ )
+			{
+				tlngP->rhombi[rhId].neighbours[nghbrNum].rhId = -1;  // I.e., invalid
+				neighbour_nghbrsNghbrNum_set(&(tlngP->rhombi[rhId]),  nghbrNum,  -1);  // I.e., invalid
+			}  // for( nghbrNum ... )
+			filledType = tlngP->rhombi[rhId].filledType;
+			if( holesFilling_link(tlngP,  &filling,  rhId) > 0 )
+				numFilled[filledType - 1] ++ ;
+		}  // for( keptNum ... )
+		free(ptchP->kept);
+	}  // for( patchNum ... )
+	holesFilling_free(&filling);
+
+	printf("holesFill(): tilingId=%" PRIi8 ", by %li cells on %i threads, the band having %li rhombi\n",
+		tlngP->tilingId,  numCells,  numThreads,  numBand);
+	fflush(stdout);
+
+	free(threadStarted);
+	free(threads);
+	free(patches);
+	return true;
+}  // holesFill_byCells()
+
+
+// A private copy of tlngP's rhombi, for holesFillParallelVerifyQ().
+static void holesFill_copy(Tiling const * const tlngP,  Tiling * const copyP)
+{
+	*copyP = *tlngP;
+	copyP->arrays_Private = true;
+	copyP->rhombi = bigArray_alloc(copyP,  copyP->rhombi_NumMax,  sizeof(Rhombus),  "rhombi",  &(copyP->rhombi_Mapped));
+	if( NULL == copyP->rhombi )
+	{
+		fprintf(stderr, "holesFill_copy(): !!! NULL == rhombi, rhombi_NumMax=%li !!!\n", copyP->rhombi_NumMax);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+	memcpy(copyP->rhombi,  tlngP->rhombi,  (tlngP->numFats + tlngP->numThins) * sizeof(Rhombus));
+#if HotArrays
+	copyP->hot_NumMax = 0;
+	copyP->hotCentres = NULL;
+	copyP->hotBBoxes  = NULL;
+	copyP->hotCentres_Mapped = false;
+	copyP->hotBBoxes_Mapped  = false;
+#endif
+	hotArrays_derive(copyP,  0,  copyP->numFats + copyP->numThins);
+}  // holesFill_copy()
+
+
+// For holesFillParallelVerifyQ(): after both have been filled, are tlngP and serialP the same, rhombus by rhombus?
+static void holesFill_verify(Tiling const * const tlngP,  Tiling const * const serialP)
+{
+	RhombId rhId,  rhId_FirstDifferent = -1;
+	long int numDifferent = 0;
+	Rhombus const *rhP,  *rhP_Serial;
+	int8_t nghbrNum;
+	bool same;
+
+	for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  &&  rhId < serialP->numFats + serialP->numThins  ;  rhId ++ )
+	{
+		rhP        = &(tlngP->rhombi[rhId]);
+		rhP_Serial = &(serialP->rhombi[rhId]);
+		same = rhP->physique == rhP_Serial->physique
+			&&  rhP->filledType    == rhP_Serial->filledType
+			&&  rhP->numNeighbours == rhP_Serial->numNeighbours
+			&&  rhombus_hotCentre(tlngP, rhId).x == rhombus_hotCentre(serialP, rhId).x
+			&&  rhombus_hotCentre(tlngP, rhId).y == rhombus_hotCentre(serialP, rhId).y;
+		for( nghbrNum = 0  ;  same  &&  nghbrNum < rhP->numNeighbours  ;  nghbrNum ++ )
+			same = rhP->neighbours[nghbrNum].rhId == rhP_Serial->neighbours[nghbrNum].rhId
+				&&  neighbour_nghbrsNghbrNum(rhP, nghbrNum) == neighbour_nghbrsNghbrNum(rhP_Serial, nghbrNum);
+		if( ! same )
 		{
-			printf("holesFill(), G: tilingId=%" PRIi8 ", numFilledTypeG = %li\n", tlngP->tilingId, numFilledTypeG);
-			rhombi_purgeDuplicates(tlngP);  // Two thins, touching at a vertex, can create overlapping fats.
-			neighbours_populate(tlngP);
-		}  // if( anyChangesThisType )
-		if( debug_holesFill )   printf("holesFill(): tilingId=%02" PRIi8 ",  -G\n", tlngP->tilingId);
+			if( 0 == numDifferent )
+				rhId_FirstDifferent = rhId;
+			numDifferent ++;
+		}  // if( ! same )
+	}  // for( rhId ... )
+
+	if( 0 == numDifferent  &&  tlngP->numFats == serialP->numFats  &&  tlngP->numThins == serialP->numThins )
+		printf("holesFill(): tilingId=%" PRIi8 ", all %li rhombi are as made serially.\n",  tlngP->tilingId,  tlngP->numFats + tlngP->numThins);
+	else
+	{
+		fprintf(stderr, "holesFill(): !!! tilingId=%" PRIi8 ", #fats=%li, #thins=%li, serially #fats=%li, #thins=%li; %li rhombi differ, the first being rhId=%li !!!\n",
+			tlngP->tilingId,  tlngP->numFats,  tlngP->numThins,  serialP->numFats,  serialP->numThins,  numDifferent,  rhId_FirstDifferent);
+		fflush(stderr);
+	}
+	fflush(stdout);
+}  // holesFill_verify()
+
 
 
-	} while(anyChanges);
+
+void holesFill(Tiling * const tlngP)
+{
+	long int numFilled[HolesFilling_NumFillTypes] = {0},  numFilledTotal = 0;
+	long int numFilledSerial[HolesFilling_NumFillTypes] = {0};
+	uint8_t signatureTable[FillSignature_NumSignatures];
+	int8_t fillNum;
+	long int const numRhombiBefore = tlngP->numFats + tlngP->numThins;
+	bool const byWorklist = holesFillByWorklistQ(tlngP);
+	int const numThreads = (byWorklist ? holesFillNumThreads(tlngP) : 1);
+	bool const verify = (numThreads > 1  &&  holesFillParallelVerifyQ());
+	Tiling serial;
+
+	holesFill_signatureTable(signatureTable);
+	if( verify )
+		holesFill_copy(tlngP,  &serial);
+
+	if( numThreads <= 1  ||  ! holesFill_byCells(tlngP,  signatureTable,  numThreads,  numFilled) )
+		holesFill_serial(tlngP,  byWorklist,  signatureTable,  NULL,  numFilled);
+
+	// No rhombi_purgeDuplicates() or neighbours_populate(): each new rhombus was at once linked with all its neighbours, so
+	// the fillTypes see it, and do not remake it.
+	for( fillNum = 0  ;  fillNum < HolesFilling_NumFillTypes  ;  fillNum ++ )
+		numFilledTotal += numFilled[fillNum];
+	if( numFilledTotal > 0 )
+		neighbours_canonical(tlngP,  numRhombiBefore);  // As neighbours_populate() would leave them, without again finding them.
+
+	if( verify )
+	{
+		holesFill_serial(&serial,  true,  signatureTable,  NULL,  numFilledSerial);
+		if( serial.numFats + serial.numThins > numRhombiBefore )
+			neighbours_canonical(&serial,  numRhombiBefore);
+		holesFill_verify(tlngP,  &serial);
+		bigArray_free(serial.rhombi,  serial.rhombi_NumMax,  sizeof(Rhombus),  serial.rhombi_Mapped);
+		hotArrays_free(&serial);
+	}  // if( verify )
 
 	printf(
 		"holesFill(): tilingId=%" PRIi8 ", extras = [ %li, %li, %li, %li, %li, %li, %li ]; #fats=%li; #thins=%li\n",
 		tlngP->tilingId,
-		numFilledTypeA,  numFilledTypeB,  numFilledTypeC,  numFilledTypeD,  numFilledTypeE,  numFilledTypeF,  numFilledTypeG,
+		numFilled[0],  numFilled[1],  numFilled[2],  numFilled[3],  numFilled[4],  numFilled[5],  numFilled[6],
 		tlngP->numFats,  tlngP->numThins
 	);  fflush(stdout);
-
 }  // holesFill()
@@ -0,0 +1,68 @@
+// By and copyright Julian D. A. Wiseman of www.jdawiseman.com, April 2025
+// Released under GNU General Public License, Version 3, https://www.gnu.org/licenses/gpl-3.0.txt
+// hotArrays.c, in PenroseC
+
+#include "penrose.h"
+
+#if HotArrays
+
+/*
+	Some loops, run many times, read only rhombi's centres or bounding boxes. So those are not in Rhombus, but in
+	separate arrays of the tiling, hotCentres[] and hotBBoxes[], indexed by rhId, so that such loops read only useful
+	bytes, and so that sorts and purges move smaller records. Read via rhombus_hotCentre() and rhombus_hotBBox(),
+	defined in penrose.h. Kept in step with rhombi[] by the code that appends, purges, and sorts: each entry is set by
+	hotArrays_set() when its rhombus is appended, moved with it by hotArrays_move() when purged, and re-derived by
+	hotArrays_derive() after a sort. Each is a function of the rhombus's vertices, so can always be re-derived.
+*/
+
+
+// Ensures the hot arrays have space for rhombi_NumMax rhombi.
+static void hotArrays_reserve(Tiling * const tlngP)
+{
+	if( tlngP->hot_NumMax >= tlngP->rhombi_NumMax )
+		return;
+
+	tlngP->hotCentres = bigArray_resize(tlngP,  tlngP->hotCentres,  tlngP->hot_NumMax,  tlngP->rhombi_NumMax,  sizeof(XY),    "hotCentres",  &(tlngP->hotCentres_Mapped));
+	tlngP->hotBBoxes  = bigArray_resize(tlngP,  tlngP->hotBBoxes,   tlngP->hot_NumMax,  tlngP->rhombi_NumMax,  sizeof(BBox),  "hotBBoxes",   &(tlngP->hotBBoxes_Mapped));
+	if( NULL == tlngP->hotCentres  ||  NULL == tlngP->hotBBoxes )
+	{
+		fprintf(stderr, "hotArrays_reserve(): !!! resize failure, tilingId=%" PRIi8 ", from %li to %li !!!\n", tlngP->tilingId, tlngP->hot_NumMax, tlngP->rhombi_NumMax);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+	tlngP->hot_NumMax = tlngP->rhombi_NumMax;
+}  // hotArrays_reserve()
+
+
+// Sets the hot entries of rhombi[rhId] from its vertices.
+void hotArrays_set(Tiling * const tlngP,  RhombId const rhId)
+{
+	if( rhId >= tlngP->hot_NumMax )
+		hotArrays_reserve(tlngP);
+
+	tlngP->hotCentres[rhId] = rhombus_derivedCentre(tlngP,  &(tlngP->rhombi[rhId]));
+	tlngP->hotBBoxes[rhId]  = rhombus_derivedBBox(  tlngP,  &(tlngP->rhombi[rhId]));
+}  // hotArrays_set()
+
+
+// Sets the hot entries of rhombi[rhIdFirst] to rhombi[rhIdEnd - 1], as needed after they have been reordered.
+void hotArrays_derive(Tiling * const tlngP,  RhombId const rhIdFirst,  RhombId const rhIdEnd)
+{
+	RhombId rhId;
+	for( rhId = rhIdFirst  ;  rhId < rhIdEnd  ;  rhId ++ )
+		hotArrays_set(tlngP,  rhId);
+}  // hotArrays_derive()
+
+
+void hotArrays_free(Tiling * const tlngP)
+{
+	bigArray_free( tlngP->hotCentres,  tlngP->hot_NumMax,  sizeof(XY),    tlngP->hotCentres_Mapped );
+	bigArray_free( tlngP->hotBBoxes,   tlngP->hot_NumMax,  sizeof(BBox),  tlngP->hotBBoxes_Mapped );
+	tlngP->hotCentres = NULL;
+	tlngP->hotBBoxes  = NULL;
+	tlngP->hotCentres_Mapped = false;
+	tlngP->hotBBoxes_Mapped  = false;
+	tlngP->hot_NumMax = 0;
+}  // hotArrays_free()
+
+#endif  // HotArrays
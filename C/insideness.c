@@ -209,7 +209,7 @@ this_path_done: ;
 			for( nghbrNum = 0  ;  nghbrNum < tlngP->rhombi[rhId].numNeighbours  ;  nghbrNum ++ )
 			{
 				nghbrP = &(tlngP->rhombi[rhId].neighbours[nghbrNum]);
-				if( Fat == nghbrP->physique )
+				if( Fat == neighbour_physique(tlngP, nghbrP) )
 				{
 					pathThisId = tlngP->rhombi[ nghbrP->rhId ].pathId ;
 					if( ! tlngP->path[pathThisId].pathClosed )
@@ -0,0 +1,133 @@
+// By and copyright Julian D. A. Wiseman of www.jdawiseman.com, April 2025
+// Released under GNU General Public License, Version 3, https://www.gnu.org/licenses/gpl-3.0.txt
+// lattice.c, in PenroseC
+
+#include "penrose.h"
+
+#if ExactCoordinates
+
+/*
+	Exact coordinates, used iff ExactCoordinates.
+
+	Every edge of every rhombus is parallel to one of ten unit vectors, at multiples of 36 degrees.
+	Write e[k] = edgeLength * (Cos(72k deg + theta), Sin(72k deg + theta)), k = 0..4, with theta fixed by
+	the initial rhombus. Then every vertex is an integer combination of the e[k]. Because
+	e[0]+e[1]+e[2]+e[3]+e[4] = 0, and because e[0..3] are linearly independent over the rationals, each
+	vertex has a unique representation with the coefficient of e[4] being zero. A Lattice holds the
+	other four coefficients, so two points are equal iff their Lattices are equal: no epsilons.
+
+	The ten unit vectors: unit[j] = e[j/2] if j even, and -e[((j+5)%10)/2] if j odd.
+
+	GoldenRatio * e[k] = e[k-1] + e[k] + e[k+1], which is also the change of basis from one tilingId to
+	the next, as the edge length divides by GoldenRatio. So descendants also have integer coordinates.
+	Magnitudes of coefficients grow by about GoldenRatio per tilingId, so int32_t is ample.
+*/
+
+
+static inline Lattice lattice_fromFive(int32_t const c[5])
+{
+	return (Lattice){ .a = {c[0] - c[4],  c[1] - c[4],  c[2] - c[4],  c[3] - c[4]} };
+}  // lattice_fromFive()
+
+
+bool lattice_same(Lattice const p0,  Lattice const p1)
+{
+	return p0.a[0] == p1.a[0]  &&  p0.a[1] == p1.a[1]  &&  p0.a[2] == p1.a[2]  &&  p0.a[3] == p1.a[3];
+}  // lattice_same()
+
+
+Lattice lattice_add(Lattice const p0,  Lattice const p1)
+{
+	return (Lattice){ .a = {p0.a[0] + p1.a[0],  p0.a[1] + p1.a[1],  p0.a[2] + p1.a[2],  p0.a[3] + p1.a[3]} };
+}  // lattice_add()
+
+
+Lattice lattice_subtract(Lattice const p0,  Lattice const p1)
+{
+	return (Lattice){ .a = {p0.a[0] - p1.a[0],  p0.a[1] - p1.a[1],  p0.a[2] - p1.a[2],  p0.a[3] - p1.a[3]} };
+}  // lattice_subtract()
+
+
+// Multiplication by GoldenRatio; equivalently, the same point in the basis of the next tilingId.
+Lattice lattice_timesGoldenRatio(Lattice const p)
+{
+	int32_t const c[5] = {p.a[0],  p.a[1],  p.a[2],  p.a[3],  0};
+	int32_t d[5];
+	int8_t k;
+	for( k = 0  ;  k < 5  ;  k ++ )
+		d[k] = c[(k + 4) % 5]  +  c[k]  +  c[(k + 1) % 5];
+	return lattice_fromFive(d);
+}  // lattice_timesGoldenRatio()
+
+
+// Rotation about the origin by steps * 36 degrees. Rotating e[k] by 36 degrees gives -e[(k+3)%5].
+Lattice lattice_rotate(Lattice const p,  int8_t steps)
+{
+	int32_t c[5], d[5];
+	int8_t k;
+
+	for( k = 0  ;  k < 4  ;  k ++ )
+		c[k] = p.a[k];
+	c[4] = 0;
+
+	steps = ((steps % 10) + 10) % 10;
+	for(  ;  steps > 0  ;  steps -- )
+	{
+		for( k = 0  ;  k < 5  ;  k ++ )
+			d[(k + 3) % 5] = - c[k];
+		for( k = 0  ;  k < 5  ;  k ++ )
+			c[k] = d[k];
+	}  // for( steps ... )
+
+	return lattice_fromFive(c);
+}  // lattice_rotate()
+
+
+// unit[j], for any integer j.
+Lattice lattice_unit(int8_t j)
+{
+	int32_t c[5] = {0, 0, 0, 0, 0};
+
+	j = ((j % 10) + 10) % 10;
+	if( 0 == j % 2 )
+		c[j / 2] = +1;
+	else
+		c[((j + 5) % 10) / 2] = -1;
+	return lattice_fromFive(c);
+}  // lattice_unit()
+
+
+XY lattice_xy(Tiling const * const tlngP,  Lattice const p)
+{
+	return (XY){
+		.x = tlngP->latticeOrigin.x  +  p.a[0] * tlngP->latticeBasis[0].x  +  p.a[1] * tlngP->latticeBasis[1].x  +  p.a[2] * tlngP->latticeBasis[2].x  +  p.a[3] * tlngP->latticeBasis[3].x,
+		.y = tlngP->latticeOrigin.y  +  p.a[0] * tlngP->latticeBasis[0].y  +  p.a[1] * tlngP->latticeBasis[1].y  +  p.a[2] * tlngP->latticeBasis[2].y  +  p.a[3] * tlngP->latticeBasis[3].y
+	};
+}  // lattice_xy()
+
+
+// Sets latticeOrigin and latticeBasis[] such that point is (0,0,0,0), and unit[0] is in direction angleRadians.
+void lattice_basis_initial(Tiling * const tlngP,  XY const origin,  double const angleRadians)
+{
+	int8_t k;
+	tlngP->latticeOrigin = origin;
+	for( k = 0  ;  k < 4  ;  k ++ )
+	{
+		tlngP->latticeBasis[k].x = tlngP->edgeLength * cos(angleRadians + k * 72 / DegreesPerRadian);
+		tlngP->latticeBasis[k].y = tlngP->edgeLength * sin(angleRadians + k * 72 / DegreesPerRadian);
+	}  // for( k ... )
+}  // lattice_basis_initial()
+
+
+void lattice_basis_descendant(Tiling * const tlngDescendantP,  Tiling const * const tlngAncestorP)
+{
+	int8_t k;
+	tlngDescendantP->latticeOrigin = tlngAncestorP->latticeOrigin;
+	for( k = 0  ;  k < 4  ;  k ++ )
+	{
+		tlngDescendantP->latticeBasis[k].x = tlngAncestorP->latticeBasis[k].x * GoldenRatioReciprocal;
+		tlngDescendantP->latticeBasis[k].y = tlngAncestorP->latticeBasis[k].y * GoldenRatioReciprocal;
+	}  // for( k ... )
+}  // lattice_basis_descendant()
+
+#endif  // ExactCoordinates
@@ -0,0 +1,274 @@
+// By and copyright Julian D. A. Wiseman of www.jdawiseman.com, April 2025
+// Released under GNU General Public License, Version 3, https://www.gnu.org/licenses/gpl-3.0.txt
+// locate.c, in PenroseC
+
+#include "penrose.h"
+
+/*
+	Which rhombus is at a point, in a deep tiling, without making the whole tiling.
+	From a seed tiling, typically tilingId 0, each later tiling is made only near the point: the region of interest (see
+	regionOfInterest.c) being just the point, with a margin. So each level has a bounded number of rhombi, and the work is
+	proportional to the depth. The same functions make each level as make the whole tiling: rhombus_append_descendants(),
+	rhombi_purgeDuplicates(), neighbours_populate(), and holesFill(); so the rhombus found is as in the whole tiling.
+	Paths are not found, as a path can be hundreds of rhombi long, needing a larger region, for which use roi_polygon().
+*/
+
+#define Locate_Margin_EdgeLengths 8  // Of the wanted tilingId, as in roi_margin().
+
+
+// Makes an empty *patchP, as a descendant of *ancestorP would start in tiling_descendant(), with no region of interest.
+static void locate_patchStart(Tiling * const patchP,  Tiling const * const ancestorP)
+{
+	*patchP = *ancestorP;  // Copies numTilings, axisAligned, filePath, etc., as might be used by rhombus_keep().
+	patchP->tilingId = ancestorP->tilingId + 1;
+	patchP->edgeLength = ancestorP->edgeLength * GoldenRatioReciprocal;
+#if ExactCoordinates
+	lattice_basis_descendant(patchP,  ancestorP);
+#endif
+	patchP->rhombi_NumMax = 0;
+	patchP->rhombi = NULL;
+	patchP->rhombi_Mapped = false;
+	patchP->rhombi_Spatial = false;
+	patchP->rhombi_Scratch = false;
+	patchP->arrays_Private = false;
+	patchP->numFats = 0;
+	patchP->numThins = 0;
+	patchP->xMin = DBL_MAX;
+	patchP->yMin = DBL_MAX;
+	patchP->xMax = - DBL_MAX;
+	patchP->yMax = - DBL_MAX;
+	patchP->roi_numVertices = 0;
+	patchP->roi_vertices = NULL;
+	patchP->roi_marginDistance = 0;
+	patchP->path_NumMax = 0;
+	patchP->path = NULL;
+	patchP->path_Mapped = false;
+	patchP->pathRhIds = NULL;
+	patchP->pathRhIds_Mapped = false;
+	patchP->numPathsClosed = 0;
+	patchP->numPathsOpen = 0;
+	patchP->pathStats_NumMax = 0;
+	patchP->pathStat = NULL;
+	patchP->pathStat_Mapped = false;
+	patchP->numPathStats = 0;
+	patchP->wantedPostScriptRhombNum = NULL;
+	patchP->wantedPostScriptPathNum  = NULL;
+#if HotArrays
+	patchP->hot_NumMax = 0;
+	patchP->hotCentres = NULL;
+	patchP->hotBBoxes  = NULL;
+	patchP->hotCentres_Mapped = false;
+	patchP->hotBBoxes_Mapped  = false;
+#endif
+}  // locate_patchStart()
+
+
+// Whether p is within the rhombus, or on its boundary.
+static bool rhombus_containsPoint(Tiling const * const tlngP,  Rhombus const * const rhP,  XY const p)
+{
+	XY const corners[4] = {rhombus_north(tlngP, rhP),  rhombus_east(tlngP, rhP),  rhombus_south(tlngP, rhP),  rhombus_west(tlngP, rhP)};
+	int8_t cornerNum;
+	bool anyPositive = false,  anyNegative = false;
+	double cross;
+
+	if( p.x < rhombus_bbox(tlngP, rhP, xMin)  ||  p.x > rhombus_bbox(tlngP, rhP, xMax)  ||  p.y < rhombus_bbox(tlngP, rhP, yMin)  ||  p.y > rhombus_bbox(tlngP, rhP, yMax) )
+		return false;
+
+	for( cornerNum = 0  ;  cornerNum < 4  ;  cornerNum ++ )
+	{
+		cross =   (corners[(cornerNum + 1) % 4].x - corners[cornerNum].x) * (p.y - corners[cornerNum].y)
+		        - (corners[(cornerNum + 1) % 4].y - corners[cornerNum].y) * (p.x - corners[cornerNum].x);
+		if( cross > 0 )  anyPositive = true;
+		if( cross < 0 )  anyNegative = true;
+	}  // for( cornerNum ... )
+
+	return ! (anyPositive && anyNegative);
+}  // rhombus_containsPoint()
+
+
+// Sets *locP to the rhombus of tilingId tilingIdWanted containing point, and its ancestry back to tlngSeedP, which must be a
+// complete tiling with tilingId <= tilingIdWanted. If neighbourhoodRadius > 0, also the rhombi with centres within that distance
+// of point. Returns false if point is outside the tiling, or tilingIdWanted is too small. Afterwards call locate_free().
+bool locate_point(
+	Tiling  const * const tlngSeedP,
+	XY              const point,
+	TilingId        const tilingIdWanted,
+	double          const neighbourhoodRadius,
+	Located       * const locP
+)
+{
+	int8_t  const numLevels = tilingIdWanted - tlngSeedP->tilingId;  // Number of patches to be made
+	Tiling  *patches,  scratch;
+	Tiling  const *levelP,  *ancestorP,  *targetTlngP;
+	Rhombus const *rhP;
+	Rhombus target;
+	RhombId rhId,  rhId_Found,  rhIds[5],  *rhIdsNew;
+	int8_t  levelNum,  childNum,  nghbrNum;
+	bool    foundParent;
+	double  margin;
+
+	locP->tilingId         = tilingIdWanted;
+	locP->rootTilingId     = tlngSeedP->tilingId;
+	locP->rootRhId         = -1;
+	locP->address          = NULL;
+	locP->numNeighbourhood = 0;
+	locP->neighbourhood    = NULL;
+	if( numLevels < 0 )
+		return false;
+
+	patches      = malloc( (numLevels > 0 ? numLevels : 1)  *  sizeof(Tiling) );
+	locP->address = malloc( (tilingIdWanted + 1)  *  sizeof(int8_t) );
+	if( NULL == patches  ||  NULL == locP->address )
+	{
+		fprintf(stderr, "locate_point(): !!! malloc() failure, numLevels=%" PRIi8 " !!!\n", numLevels);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+	for( levelNum = 0  ;  levelNum <= tilingIdWanted  ;  levelNum ++ )
+		locP->address[levelNum] = -1;
+
+	// Margin in distance, fixed for all levels, so that the wanted tiling is complete near the point.
+	margin = neighbourhoodRadius  +  Locate_Margin_EdgeLengths * tlngSeedP->edgeLength * pow(GoldenRatioReciprocal, numLevels);
+
+	for( levelNum = 0  ;  levelNum < numLevels  ;  levelNum ++ )
+	{
+		ancestorP = ( 0 == levelNum  ?  tlngSeedP  :  &(patches[levelNum - 1]) );
+		locate_patchStart( &(patches[levelNum]),  ancestorP );
+		patches[levelNum].roi_numVertices    = 1;
+		patches[levelNum].roi_vertices       = &point;
+		patches[levelNum].roi_marginDistance = margin;
+
+		for( rhId = 0  ;  rhId < ancestorP->numFats + ancestorP->numThins  ;  rhId ++ )
+			rhombus_append_descendants( &(patches[levelNum]),  ancestorP,  ancestorP->rhombi + rhId,  false,  NULL );
+		rhombi_purgeDuplicates( &(patches[levelNum]) );
+		neighbours_populate( &(patches[levelNum]) );
+		if( holesFillQ( &(patches[levelNum]) ) )
+			holesFill( &(patches[levelNum]) );
+	}  // for( levelNum ... )
+
+	levelP = ( 0 == numLevels  ?  tlngSeedP  :  &(patches[numLevels - 1]) );
+	rhId_Found = -1;
+	for( rhId = 0  ;  rhId < levelP->numFats + levelP->numThins  &&  rhId_Found < 0  ;  rhId ++ )
+		if( rhombus_containsPoint(levelP,  levelP->rhombi + rhId,  point) )
+			rhId_Found = rhId;
+
+	if( rhId_Found >= 0 )
+	{
+		locP->rhombus      = levelP->rhombi[rhId_Found];
+		locP->north        = rhombus_north(levelP,  &(locP->rhombus));
+		locP->south        = rhombus_south(levelP,  &(locP->rhombus));
+		locP->centre       = rhombus_centre(levelP,  &(locP->rhombus));
+		locP->angleDegrees = rhombus_angleDegrees(levelP,  &(locP->rhombus));
+
+		// Neighbourhood, with rhIds renumbered to index it, -1 if outside.
+		if( neighbourhoodRadius > 0 )
+		{
+			locP->neighbourhood = malloc( (levelP->numFats + levelP->numThins)  *  sizeof(Rhombus) );
+			rhIdsNew            = malloc( (levelP->numFats + levelP->numThins)  *  sizeof(RhombId) );
+			if( NULL == locP->neighbourhood  ||  NULL == rhIdsNew )
+			{
+				fprintf(stderr, "locate_point(): !!! malloc() failure, numRhombi=%li !!!\n", levelP->numFats + levelP->numThins);
+				fflush(stderr);
+				exit(EXIT_FAILURE);
+			}
+			for( rhId = 0  ;  rhId < levelP->numFats + levelP->numThins  ;  rhId ++ )
+			{
+				rhP = levelP->rhombi + rhId;
+				if( pow(rhombus_hotCentre(levelP, rhId).x - point.x, 2)  +  pow(rhombus_hotCentre(levelP, rhId).y - point.y, 2)  <=  pow(neighbourhoodRadius, 2)  ||  rhId == rhId_Found )
+				{
+					rhIdsNew[rhId] = locP->numNeighbourhood;
+					locP->neighbourhood[ locP->numNeighbourhood ++ ] = *rhP;
+				}
+				else
+					rhIdsNew[rhId] = -1;
+			}  // for( rhId ... )
+			for( rhId = 0  ;  rhId < locP->numNeighbourhood  ;  rhId ++ )
+			{
+				locP->neighbourhood[rhId].rhId = rhId;
+				for( nghbrNum = 0  ;  nghbrNum < locP->neighbourhood[rhId].numNeighbours  ;  nghbrNum ++ )
+					locP->neighbourhood[rhId].neighbours[nghbrNum].rhId = rhIdsNew[ locP->neighbourhood[rhId].neighbours[nghbrNum].rhId ];
+			}  // for( rhId ... )
+			locP->rhombus = locP->neighbourhood[ rhIdsNew[rhId_Found] ];
+			free(rhIdsNew);
+		}  // neighbourhoodRadius > 0
+		else
+			for( nghbrNum = 0  ;  nghbrNum < locP->rhombus.numNeighbours  ;  nghbrNum ++ )
+				locP->rhombus.neighbours[nghbrNum].rhId = -1;
+
+		// Ancestry: for each level, which child of which rhombus of the previous level. If none, made by holesFill().
+		target      = levelP->rhombi[rhId_Found];
+		targetTlngP = levelP;
+		for( levelNum = numLevels - 1  ;  levelNum >= 0  ;  levelNum -- )
+		{
+			ancestorP = ( 0 == levelNum  ?  tlngSeedP  :  &(patches[levelNum - 1]) );
+			foundParent = false;
+			for( rhId = 0  ;  rhId < ancestorP->numFats + ancestorP->numThins  &&  ! foundParent  ;  rhId ++ )
+			{
+				rhP = ancestorP->rhombi + rhId;
+				if( pow(rhombus_hotCentre(ancestorP, rhId).x - rhombus_centre(targetTlngP, &target).x, 2)  +  pow(rhombus_hotCentre(ancestorP, rhId).y - rhombus_centre(targetTlngP, &target).y, 2)  >  pow(2 * ancestorP->edgeLength, 2) )
+					continue;  // Too far to be the parent.
+				locate_patchStart(&scratch,  ancestorP);
+				rhombus_append_descendants(&scratch,  ancestorP,  ancestorP->rhombi + rhId,  false,  rhIds);
+				for( childNum = 0  ;  childNum < 5  &&  ! foundParent  ;  childNum ++ )
+					if( rhIds[childNum] >= 0
+					&&  scratch.rhombi[ rhIds[childNum] ].physique == target.physique
+					&&  points_same_2(&scratch,  rhombus_north(&scratch, &(scratch.rhombi[ rhIds[childNum] ])),  rhombus_north(targetTlngP, &target))
+					&&  points_same_2(&scratch,  rhombus_south(&scratch, &(scratch.rhombi[ rhIds[childNum] ])),  rhombus_south(targetTlngP, &target)) )
+					{
+						foundParent = true;
+						locP->address[ tlngSeedP->tilingId + levelNum + 1 ] = childNum;
+						target      = *rhP;
+						targetTlngP = ancestorP;
+					}  // Same
+				tiling_empty(&scratch);
+			}  // for( rhId ... )
+
+			if( ! foundParent )
+			{
+				locP->rootTilingId = tlngSeedP->tilingId + levelNum + 1;  // Made by holesFill()
+				break;
+			}
+		}  // for( levelNum ... )
+		locP->root       = target;
+		locP->rootCentre = rhombus_centre(targetTlngP, &target);
+		if( locP->rootTilingId == tlngSeedP->tilingId )
+			locP->rootRhId = target.rhId;
+	}  // rhId_Found >= 0
+
+	for( levelNum = 0  ;  levelNum < numLevels  ;  levelNum ++ )
+		tiling_empty( &(patches[levelNum]) );
+	free(patches);
+
+	return( rhId_Found >= 0 );
+}  // locate_point()
+
+
+void locate_free(Located * const locP)
+{
+	free(locP->address);        locP->address       = NULL;
+	free(locP->neighbourhood);  locP->neighbourhood = NULL;
+	locP->numNeighbourhood = 0;
+}  // locate_free()
+
+
+void locate_print(FILE * const fp,  XY const point,  Located const * const locP)
+{
+	TilingId tilingId;
+
+	fprintf(fp,
+		"locate: point (%0.12lf, %0.12lf) at tilingId=%" PRIi8 " is in a %s rhombus with north (%0.12lf, %0.12lf), south (%0.12lf, %0.12lf), "
+		"centre (%0.12lf, %0.12lf), angle %0.1lf degrees, %" PRIi8 " neighbours.\n",
+		point.x,  point.y,  locP->tilingId,  Fat == locP->rhombus.physique ? "fat" : "thin",
+		locP->north.x,  locP->north.y,  locP->south.x,  locP->south.y,
+		locP->centre.x,  locP->centre.y,  locP->angleDegrees,  locP->rhombus.numNeighbours
+	);
+	if( locP->rootRhId >= 0 )
+		fprintf(fp,  "locate: ancestry from rhId=%li of tilingId=%" PRIi8 ", then child numbers",  locP->rootRhId,  locP->rootTilingId);
+	else
+		fprintf(fp,  "locate: ancestry from a %s rhombus made by holesFill() in tilingId=%" PRIi8 ", centre (%0.12lf, %0.12lf), then child numbers",
+			Fat == locP->root.physique ? "fat" : "thin",  locP->rootTilingId,  locP->rootCentre.x,  locP->rootCentre.y);
+	for( tilingId = locP->rootTilingId + 1  ;  tilingId <= locP->tilingId  ;  tilingId ++ )
+		fprintf(fp,  " %" PRIi8,  locP->address[tilingId]);
+	fprintf(fp,  ".\nlocate: %li rhombi in neighbourhood.\n",  locP->numNeighbourhood);
+	fflush(fp);
+}  // locate_print()
@@ -4,7 +4,7 @@
 
 #include "penrose.h"
 
-static int8_t const numTilings_Max = 17;  // Hard-wired contraint to catch CPU-expensive mistyping. Sensible limit for 32GiB machine. YMMV.
+static int8_t const numTilings_Max = 20;  // Hard-wired contraint to catch CPU-expensive mistyping. Sensible limit for 32GiB machine is 17, or more with arraysMappedQ() and tilingsLowMemoryQ(). YMMV.
 
 char scratchString[scratchStringLength] ;  // Mostly used for post-processing of doubles: removal of trailing 0s and trailing decimal points. Size harmlessly generous: 6k would have been sufficient, the boundary need being the preamble in tiling_export_PaintRhombiPS.
 
@@ -21,6 +21,16 @@ int main(void)
 
 	Tiling *tlngs;
 	FILE *fp;
+	bool const lowMemory = tilingsLowMemoryQ();
+	bool const byPentagrid = tilingsByPentagridQ();
+	int ef_num;
+
+	// If ExportFormat acquires other possibilites, give attention to this, to the "3" in next line, and to the extension calculation.
+	// Also, want PS_data last, because of sort-by wanted.
+	const ExportFormat exportFormat[3] = {TSV, PS_data, JSON};  // TSV most useful, so first; JSON most massive, so last.
+	bool anythingToExport[3] = {false, false, false};
+	unsigned long int      partsNumLines[3][numTilings_Max];
+	unsigned long long int partsNumChars[3][numTilings_Max];
 	TilingId tilingId;
 	time_t prog_start;
 	struct tm *timeData;
@@ -36,6 +46,7 @@ int main(void)
 		"What is to be the recursion depth = numTilings?\n"
 		"For testing choose in range 8 to 12.\n"
 		"By memory constraint on a 32GiB machine, maximum is 17, run time being, on author's computer, about 5 hours. Obviously, YMMV.\n"
+		"Deeper needs arraysMappedQ() and tilingsLowMemoryQ() to be true, in controls.c, and much disk space and time.\n"
 	);  fflush(stdout);
 	do
 	{
@@ -62,7 +73,7 @@ int main(void)
 		timeData->tm_hour,  timeData->tm_min,  (int)(timeData->tm_sec)
 	);
 	
-	clock_t const timeBeginConstruction = clock();
+	double const timeBeginConstruction = wallClockSeconds();  // Not clock(), which would sum the threads of descendantsNumThreads().
 
 	for( tilingId = 0;  tilingId < numTilings;  tilingId++ )
 	{
@@ -77,6 +88,9 @@ int main(void)
 		tlngs[tilingId].numPathsClosed           = 0;
 		tlngs[tilingId].numPathsOpen             = 0;
 		tlngs[tilingId].numPathStats             = 0;
+		tlngs[tilingId].roi_numVertices          = 0;
+		tlngs[tilingId].roi_vertices             = NULL;
+		tlngs[tilingId].roi_marginDistance       = 0;
 		tlngs[tilingId].xMin                     = DBL_MAX;
 		tlngs[tilingId].yMin                     = DBL_MAX;
 		tlngs[tilingId].xMax                     = - DBL_MAX;
@@ -84,6 +98,14 @@ int main(void)
 		tlngs[tilingId].rhombi                   = NULL;
 		tlngs[tilingId].path                     = NULL;
 		tlngs[tilingId].pathStat                 = NULL;
+		tlngs[tilingId].rhombi_Mapped            = false;
+		tlngs[tilingId].rhombi_Spatial           = false;
+		tlngs[tilingId].rhombi_Scratch           = false;
+		tlngs[tilingId].arrays_Private           = false;
+		tlngs[tilingId].path_Mapped              = false;
+		tlngs[tilingId].pathRhIds                = NULL;
+		tlngs[tilingId].pathRhIds_Mapped         = false;
+		tlngs[tilingId].pathStat_Mapped          = false;
 		tlngs[tilingId].wantedPostScriptRhombNum = NULL;
 		tlngs[tilingId].wantedPostScriptPathNum  = NULL;
 		tlngs[tilingId].filePath                 = filePath();
@@ -97,7 +119,13 @@ int main(void)
 	);  fflush(stdout);
 	for( tilingId = 0;  tilingId < numTilings;  tilingId++ )
 	{
-		if( tilingId == 0 )
+		if( byPentagrid )
+			tiling_pentagrid(
+				&(tlngs[tilingId]),
+				init_thin_xNorth, init_thin_xSouth, init_thin_yNorth, init_thin_ySouth,
+				wantedPostScriptCentre(), wantedPostScriptAspect()
+			);
+		else if( tilingId == 0 )
 		{
 			tiling_initial(
 				&(tlngs[tilingId]),
@@ -130,14 +158,7 @@ int main(void)
 
 		unsigned long int numLinesThisFile;
 		unsigned long long numCharsThisFile;
-		bool anythingToExport;
-		long int tilingIdTest;
 		ExportFormat ef;
-		int ef_num;
-
-		// If ExportFormat acquires other possibilites, give attention to this, to the "3" in next line, and to the extension calculation.
-		// Also, want PS_data last, because of sort-by wanted.
-		const ExportFormat exportFormat[3] = {TSV, PS_data, JSON};  // TSV most useful, so first; JSON most massive, so last.
 		for( ef_num = 0  ;  ef_num < 3  ; ef_num++ )
 		{
 			ef = exportFormat[ef_num];
@@ -145,15 +166,14 @@ int main(void)
 			numLinesThisFile = 0;
 			numCharsThisFile = 0;
 
-			anythingToExport = false;
-			for( tilingIdTest = 0  ;  tilingIdTest <= tilingId  ;  tilingIdTest++ )
-				if( exportQ(Anything, ef, &(tlngs[tilingIdTest]), numLinesThisFile ) )  // If any to be output in this ExportFormat
-				{
-					anythingToExport = true;
-					break;
-				}
+			if( lowMemory )
+				tilings_export_part(ef,  &exportQ,  &(tlngs[tilingId]),  0,  numTilings,  partsNumLines[ef_num],  partsNumChars[ef_num]);
 
-			if( anythingToExport )
+			// Earlier tilings are unchanged since their exportQ() was asked, and might have been freed, so remembered.
+			if( exportQ(Anything, ef, &(tlngs[tilingId]), numLinesThisFile ) )
+				anythingToExport[ef_num] = true;
+
+			if( anythingToExport[ef_num] )
 			{
 				sprintf(fileName,
 					"%sPenrose_%s_Rhombi_%02" PRIi8 ".%s",
@@ -162,16 +182,28 @@ int main(void)
 				);
 				numLinesThisFile = 0;
 				fp=fopen(fileName, "w");
-				tilings_export(
-					fp,
-					ef,
-					&exportQ,
-					tlngs,
-					0,
-					numTilings,
-					&numLinesThisFile,
-					&numCharsThisFile
-				);
+				if( lowMemory )
+					tilings_export_fromParts(
+						fp,
+						ef,
+						&(tlngs[tilingId]),
+						0,
+						partsNumLines[ef_num],
+						partsNumChars[ef_num],
+						&numLinesThisFile,
+						&numCharsThisFile
+					);
+				else
+					tilings_export(
+						fp,
+						ef,
+						&exportQ,
+						tlngs,
+						0,
+						numTilings,
+						&numLinesThisFile,
+						&numCharsThisFile
+					);
 				fflush(fp); fclose(fp);
 				printf(
 					"main(): during tilingId=%" PRIi8 ", exported %lli chars %li lines, so %0.1lf c/l, to %s\n",
@@ -185,12 +217,37 @@ int main(void)
 			"#Fats=%li; #Thins=%li; #PathsClosed=%li; #PathsOpen=%li; #PathStats=%li; LongestPathClosed=%li; #LongestPathOpen=%li;\n"
 			"total execution time = %0.3lfs\n",
 			tilingId,  tlngs[tilingId].numFats,  tlngs[tilingId].numThins,  tlngs[tilingId].numPathsClosed,  tlngs[tilingId].numPathsOpen,  tlngs[tilingId].numPathStats,
-			longestPathClosed,  longestPathOpen,  ((double)clock() - timeBeginConstruction) / CLOCKS_PER_SEC
+			longestPathClosed,  longestPathOpen,  wallClockSeconds() - timeBeginConstruction
 		);  fflush(stdout);
 
+		XY       locatePoint;
+		TilingId locateTilingId;
+		double   locateRadius;
+		if( 0 == tilingId  &&  locate_wanted(&locatePoint,  &locateTilingId,  &locateRadius) )
+		{
+			Located located;
+			double const timeBeginLocate = wallClockSeconds();
+			if( locate_point(&(tlngs[0]),  locatePoint,  locateTilingId,  locateRadius,  &located) )
+				locate_print(stdout,  locatePoint,  &located);
+			else
+				printf("main(): locate_point() found no rhombus at (%0.12lf, %0.12lf) in tilingId=%" PRIi8 ".\n",  locatePoint.x,  locatePoint.y,  locateTilingId);
+			printf("main(): %0.3lfs for locate_point().\n",  wallClockSeconds() - timeBeginLocate);  fflush(stdout);
+			locate_free(&located);
+		}  // locate_wanted()
+
+		if( lowMemory  &&  tilingId >= 1 )
+		{
+			printf("main(): low memory, so tiling_empty() of tilingId=%" PRIi8 ".\n",  tilingId - 1);  fflush(stdout);
+			tiling_empty( &(tlngs[tilingId - 1]) );
+		}  // if( lowMemory ... )
+
 		printf("\n\n");  fflush(stdout);
 	}  // for( tilingId ... )
 
+	if( lowMemory )
+		for( ef_num = 0  ;  ef_num < 3  ; ef_num++ )
+			tilings_export_removeParts( &(tlngs[0]),  exportFormat[ef_num] );
+
 	printf("main(): about to tiling_empty().\n");  fflush(stdout);
 	for( tilingId = numTilings - 1;  tilingId >= 0;  tilingId-- )
 		tiling_empty( &(tlngs[tilingId]) );
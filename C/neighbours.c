@@ -4,58 +4,11 @@
 
 #include "penrose.h"
 
-void oneRhombi_Neighbourify(
+static void twoRhombi_Link(
 	Tiling * const tlngP,
-	RhombId const rhId_This,
-	RhombId rhId_Start,
-	RhombId const rhId_End,
-	bool const isSortedWithin
-)
-{
-	register Rhombus * const rhP_This = &(tlngP->rhombi[rhId_This]);
-
-	if( rhP_This->numNeighbours >= 4 )
-		return;
-
-	const double threshold = tlngP->edgeLength / 16;
-
-	if( isSortedWithin )
-	{
-		RhombId rhId_Start_Max = rhId_End;
-		RhombId rhId_Start_Guess;
-		for(  ;  rhId_Start_Max > 1 + rhId_Start  ;  )
-		{
-			rhId_Start_Guess = (rhId_Start_Max / 2)  +  (rhId_Start / 2)  +  (rhId_Start % 2);  // Mid, slightly robust to overflow
-			if( tlngP->rhombi[rhId_Start_Guess].centre.y < rhP_This->centre.y - threshold )
-				rhId_Start = rhId_Start_Guess;
-			else
-				rhId_Start_Max = rhId_Start_Guess;
-		}  // 'while()'
-	}  // if( isSortedWithin )
-
-	register RhombId rhId;
-	register Rhombus * rhP;
-	for( rhId = rhId_Start  ;  rhId <= rhId_End  ;  rhId ++ )
-	{
-		rhP = &(tlngP->rhombi[rhId]);
-		if( isSortedWithin  &&  rhP->centre.y > rhP_This->centre.y + threshold )
-			break;
-		if( rhP->numNeighbours < 4  // Quick test, failed by most, so speed-optimal to be first.
-		&&  fabs(rhP->centre.y - rhP_This->centre.y) <= threshold  // test could be passed to points_same_2(),
-		&&  fabs(rhP->centre.x - rhP_This->centre.x) <= threshold  // but faster to compute threshold only once.
-		&&  rhId_This != rhId )  // Quick test, but passed by almost all, so speed-optimal to be last.
-		{
-			if( rhP->neighbours[0].rhId == rhId_This  // Test safe as all neighbours[].rhId initialised to -1.
-			||  rhP->neighbours[1].rhId == rhId_This
-			||  rhP->neighbours[2].rhId == rhId_This )  // Can't be 4 neighbours.
-				continue;
-
-			twoRhombi_Neighbourify(tlngP, rhId_This, rhId);
-		}  // if()
-	}  // for( rhId ... )
-}  // oneRhombi_Neighbourify()
-
-
+	RhombId const rhId_A,  bool const edge_A_N,  bool const edge_A_E,
+	RhombId const rhId_B,  bool const edge_B_N,  bool const edge_B_E
+);
 
 void twoRhombi_Neighbourify(Tiling * const tlngP,  RhombId const rhId_A,  RhombId const rhId_B)
 {
@@ -74,37 +27,37 @@ void twoRhombi_Neighbourify(Tiling * const tlngP,  RhombId const rhId_A,  RhombI
 	do {
 
 		do {
-			if( points_same_2(tlngP,  rhP_A->north,  rhP_B->north) ) {edge_A_N = true ;  edge_B_N = true ;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->north,  rhP_B->south) ) {edge_A_N = true ;  edge_B_N = false;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->north,  rhP_B->east ) ) {edge_A_N = true ;  edge_B_E = true ;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->north,  rhP_B->west ) ) {edge_A_N = true ;  edge_B_E = false;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, north,  rhP_B, north) ) {edge_A_N = true ;  edge_B_N = true ;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, north,  rhP_B, south) ) {edge_A_N = true ;  edge_B_N = false;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, north,  rhP_B, east ) ) {edge_A_N = true ;  edge_B_E = true ;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, north,  rhP_B, west ) ) {edge_A_N = true ;  edge_B_E = false;  pointsSame++;  break;}
 		} while(false);  // Minimal break'able loop construct
 
 		do {
-			if( points_same_2(tlngP,  rhP_A->south,  rhP_B->north) ) {edge_A_N = false;  edge_B_N = true ;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->south,  rhP_B->south) ) {edge_A_N = false;  edge_B_N = false;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->south,  rhP_B->east ) ) {edge_A_N = false;  edge_B_E = true ;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->south,  rhP_B->west ) ) {edge_A_N = false;  edge_B_E = false;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, south,  rhP_B, north) ) {edge_A_N = false;  edge_B_N = true ;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, south,  rhP_B, south) ) {edge_A_N = false;  edge_B_N = false;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, south,  rhP_B, east ) ) {edge_A_N = false;  edge_B_E = true ;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, south,  rhP_B, west ) ) {edge_A_N = false;  edge_B_E = false;  pointsSame++;  break;}
 		} while(false);  // Minimal break'able loop construct
 
 		if( pointsSame == 2 )
 			break;
 
 		do {
-			if( points_same_2(tlngP,  rhP_A->east ,  rhP_B->north) ) {edge_A_E = true ;  edge_B_N = true ;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->east ,  rhP_B->south) ) {edge_A_E = true ;  edge_B_N = false;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->east ,  rhP_B->east ) ) {edge_A_E = true ;  edge_B_E = true ;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->east ,  rhP_B->west ) ) {edge_A_E = true ;  edge_B_E = false;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, east ,  rhP_B, north) ) {edge_A_E = true ;  edge_B_N = true ;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, east ,  rhP_B, south) ) {edge_A_E = true ;  edge_B_N = false;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, east ,  rhP_B, east ) ) {edge_A_E = true ;  edge_B_E = true ;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, east ,  rhP_B, west ) ) {edge_A_E = true ;  edge_B_E = false;  pointsSame++;  break;}
 		} while(false);  // Minimal break'able loop construct
 
 		if( pointsSame == 2 )
 			break;
 
 		do {
-			if( points_same_2(tlngP,  rhP_A->west ,  rhP_B->north) ) {edge_A_E = false;  edge_B_N = true ;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->west ,  rhP_B->south) ) {edge_A_E = false;  edge_B_N = false;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->west ,  rhP_B->east ) ) {edge_A_E = false;  edge_B_E = true ;  pointsSame++;  break;}
-			if( points_same_2(tlngP,  rhP_A->west ,  rhP_B->west ) ) {edge_A_E = false;  edge_B_E = false;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, west ,  rhP_B, north) ) {edge_A_E = false;  edge_B_N = true ;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, west ,  rhP_B, south) ) {edge_A_E = false;  edge_B_N = false;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, west ,  rhP_B, east ) ) {edge_A_E = false;  edge_B_E = true ;  pointsSame++;  break;}
+			if( vertices_same(tlngP,  rhP_A, west ,  rhP_B, west ) ) {edge_A_E = false;  edge_B_E = false;  pointsSame++;  break;}
 		} while(false);  // Minimal break'able loop construct
 
 	} while(false);  // Minimal break'able loop construct
@@ -112,35 +65,91 @@ void twoRhombi_Neighbourify(Tiling * const tlngP,  RhombId const rhId_A,  RhombI
 	if( pointsSame != 2 )
 		{fprintf(stderr, "!!! Error, pointsSame=%" PRIi8 ", in twoRhombi_Neighbourify(tlngId=%" PRIi8 ",  %li,  %li) !!!\n", pointsSame, tlngP->tilingId, rhId_A, rhId_B);  fflush(stderr);   exit(EXIT_FAILURE);}
 
+	twoRhombi_Link(tlngP,  rhId_A,  edge_A_N,  edge_A_E,  rhId_B,  edge_B_N,  edge_B_E);
+}  // twoRhombi_Neighbourify()
+
+
+// Makes A and B neighbours, the shared edge being known: for A, its north or south, and its east or west, vertices; likewise for B.
+static void twoRhombi_Link(
+	Tiling * const tlngP,
+	RhombId const rhId_A,  bool const edge_A_N,  bool const edge_A_E,
+	RhombId const rhId_B,  bool const edge_B_N,  bool const edge_B_E
+)
+{
+	Rhombus * const rhP_A = &(tlngP->rhombi[rhId_A]);
+	Rhombus * const rhP_B = &(tlngP->rhombi[rhId_B]);
 	Neighbour *nghbrP;
 
 	nghbrP = &(rhP_A->neighbours[ rhP_A->numNeighbours ]);
 	nghbrP->touchesN       = edge_A_N;
 	nghbrP->touchesE       = edge_A_E;
 	nghbrP->rhId           = rhId_B;
+#if ! CompactRhombi  // Else read from rhombi[rhId] by neighbour_physique().
 	nghbrP->physique       = rhP_B->physique;
-	nghbrP->nghbrsNghbrNum = rhP_B->numNeighbours;
-	nghbrP->pathId         = -1;
-	nghbrP->withinPathNum  = -1;
+#endif
+	neighbour_nghbrsNghbrNum_set(rhP_A,  rhP_A->numNeighbours,  rhP_B->numNeighbours);
 
 	nghbrP = &(rhP_B->neighbours[ rhP_B->numNeighbours ]);
 	nghbrP->touchesN       = edge_B_N;
 	nghbrP->touchesE       = edge_B_E;
 	nghbrP->rhId           = rhId_A;
+#if ! CompactRhombi  // Else read from rhombi[rhId] by neighbour_physique().
 	nghbrP->physique       = rhP_A->physique;
-	nghbrP->nghbrsNghbrNum = rhP_A->numNeighbours;
-	nghbrP->pathId         = -1;
-	nghbrP->withinPathNum  = -1;
+#endif
+	neighbour_nghbrsNghbrNum_set(rhP_B,  rhP_B->numNeighbours,  rhP_A->numNeighbours);
 
 	(rhP_A->numNeighbours) ++;
 	(rhP_B->numNeighbours) ++;
-}  // twoRhombi_Neighbourify()
+}  // twoRhombi_Link()
 
 
 bool neighbours_error_true(ExportWhat const exprtWhat, ExportFormat const exportFormat, const Tiling * const tlngP, const unsigned long int numLinesThisFileP) {return true;}
 
 
-void neighbours_populate(Tiling * const tlngP)
+// Neighbourifying rhId1 and rhId2 would give one of them a fifth neighbour, so presumably there are duplicates. Fatal.
+static void neighbours_error_tooMany(Tiling * const tlngP,  RhombId const rhId1,  RhombId const rhId2)
+{
+	extern char scratchString[];
+	FILE * fp;
+	unsigned long int numLinesThisFileP;
+	unsigned long long int numCharsThisFileP;
+
+	fprintf(stderr,
+		"\n\nneighbours_populate(): error, need to connect two rhombi, but >=1 already has >=4 neighbours: tilingId=%" PRIi8 ";\n"
+		"\trhId1=%li, numNeighbours=%hi = [%li,%li,%li,%li], centre = (%0.9lf, %0.9lf);\n"
+		"\trhId2=%li, numNeighbours=%hi = [%li,%li,%li,%li], centre = (%0.9lf, %0.9lf).\n"
+		"Too many neighbours likely to be caused by duplicate rhombi. "
+		"This likely because holesFill() has made the same rhombus twice. "
+		"If a type of filling is known to do that, as one is, then, after, it should call rhombi_purgeDuplicates(). "
+		"Believed that this is done sufficiently, but the appearance of this error suggests some optimism of belief. "
+		"Ouch!\n\n",
+		tlngP->tilingId,
+		rhId1,  tlngP->rhombi[rhId1].numNeighbours,  (long int)tlngP->rhombi[rhId1].neighbours[0].rhId,  (long int)tlngP->rhombi[rhId1].neighbours[1].rhId,  (long int)tlngP->rhombi[rhId1].neighbours[2].rhId,  (long int)tlngP->rhombi[rhId1].neighbours[3].rhId,  rhombus_hotCentre(tlngP, rhId1).x,  rhombus_hotCentre(tlngP, rhId1).y,
+		rhId2,  tlngP->rhombi[rhId2].numNeighbours,  (long int)tlngP->rhombi[rhId2].neighbours[0].rhId,  (long int)tlngP->rhombi[rhId2].neighbours[1].rhId,  (long int)tlngP->rhombi[rhId2].neighbours[2].rhId,  (long int)tlngP->rhombi[rhId2].neighbours[3].rhId,  rhombus_hotCentre(tlngP, rhId2).x,  rhombus_hotCentre(tlngP, rhId2).y
+	);
+	fflush(stderr);
+	sprintf(scratchString, "%serror_neighbours_populate.tsv", tlngP->filePath);
+	fp = fopen(scratchString, "w");
+
+	tiling_export(
+		fp,
+		TSV,
+		&neighbours_error_true,
+		tlngP,
+		0,  // indentDepth,
+		false,  // notLast,
+		tlngP->tilingId,
+		&numLinesThisFileP,
+		&numCharsThisFileP
+	);
+	fflush(fp);
+	fclose(fp);
+	exit(EXIT_FAILURE);
+}  // neighbours_error_tooMany()
+
+
+// Compares each rhombus with the earlier rhombi with centres nearby in y.
+static void neighbours_populate_sorted(Tiling * const tlngP)
 {
 	RhombId      rhId1, rhId2;
 	double       xDiff, yDiff;
@@ -148,74 +157,26 @@ void neighbours_populate(Tiling * const tlngP)
 	double const thresholdNeighbour = 0.9511 * tlngP->edgeLength;  // slightly bigger than Cos(18 degrees) = sqrt(10+2*sqrt(5))/4 ~= 0.951056516295
 	double const thresholdNeighbourSqrd = thresholdNeighbour * thresholdNeighbour;
 
-	for( rhId1 = 0  ;  rhId1 < tlngP->numFats + tlngP->numThins  ;  rhId1++ )
-	{
-		tlngP->rhombi[rhId1].numNeighbours = 0;  // Reset previous neighbouring, if any
-		tlngP->rhombi[rhId1].neighbours[0].rhId = -1;
-		tlngP->rhombi[rhId1].neighbours[1].rhId = -1;
-		tlngP->rhombi[rhId1].neighbours[2].rhId = -1;
-		tlngP->rhombi[rhId1].neighbours[3].rhId = -1;
-	}
-
-	rhombi_sort(tlngP,  &rhombiGt_ByY,  false);
-
 	for( rhId1 = 1  ;  rhId1 < tlngP->numFats + tlngP->numThins  ;  rhId1++ )
 	{
 		for( rhId2 = rhId1 - 1  ;  rhId2 >= 0  ;  rhId2-- )
 		{
 			yDiff =
-				tlngP->rhombi[rhId1].centre.y -
-				tlngP->rhombi[rhId2].centre.y ;
+				rhombus_hotCentre(tlngP, rhId1).y -
+				rhombus_hotCentre(tlngP, rhId2).y ;
 
 			if( yDiff > thresholdNeighbour )
 				break;
 
 			xDiff =
-				tlngP->rhombi[rhId1].centre.x -
-				tlngP->rhombi[rhId2].centre.x ;
+				rhombus_hotCentre(tlngP, rhId1).x -
+				rhombus_hotCentre(tlngP, rhId2).x ;
 
 			if( xDiff * xDiff  +  yDiff * yDiff  <=  thresholdNeighbourSqrd )
 			{
 				if( tlngP->rhombi[rhId1].numNeighbours >= 4
 				||  tlngP->rhombi[rhId2].numNeighbours >= 4 )
-				{
-					extern char scratchString[];
-					FILE * fp;
-					unsigned long int numLinesThisFileP;
-					unsigned long long int numCharsThisFileP;
-
-					fprintf(stderr,
-						"\n\nneighbours_populate(): error, need to connect two rhombi, but >=1 already has >=4 neighbours: tilingId=%" PRIi8 ";\n"
-						"\trhId1=%li, numNeighbours=%hi = [%li,%li,%li,%li], centre = (%0.9lf, %0.9lf);\n"
-						"\trhId2=%li, numNeighbours=%hi = [%li,%li,%li,%li], centre = (%0.9lf, %0.9lf).\n"
-						"Too many neighbours likely to be caused by duplicate rhombi. "
-						"This likely because holesFill() has made the same rhombus twice. "
-						"If a type of filling is known to do that, as one is, then, after, it should call rhombi_purgeDuplicates(). "
-						"Believed that this is done sufficiently, but the appearance of this error suggests some optimism of belief. "
-						"Ouch!\n\n",
-						tlngP->tilingId,
-						rhId1,  tlngP->rhombi[rhId1].numNeighbours,  tlngP->rhombi[rhId1].neighbours[0].rhId,  tlngP->rhombi[rhId1].neighbours[1].rhId,  tlngP->rhombi[rhId1].neighbours[2].rhId,  tlngP->rhombi[rhId1].neighbours[3].rhId,  tlngP->rhombi[rhId1].centre.x,  tlngP->rhombi[rhId1].centre.y,
-						rhId2,  tlngP->rhombi[rhId2].numNeighbours,  tlngP->rhombi[rhId2].neighbours[0].rhId,  tlngP->rhombi[rhId2].neighbours[1].rhId,  tlngP->rhombi[rhId2].neighbours[2].rhId,  tlngP->rhombi[rhId2].neighbours[3].rhId,  tlngP->rhombi[rhId2].centre.x,  tlngP->rhombi[rhId2].centre.y
-					);
-					fflush(stderr);
-					sprintf(scratchString, "%serror_neighbours_populate.tsv", tlngP->filePath);
-					fp = fopen(scratchString, "w");
-
-					tiling_export(
-						fp,
-						TSV,
-						&neighbours_error_true,
-						tlngP,
-						0,  // indentDepth,
-						false,  // notLast,
-						tlngP->tilingId,
-						&numLinesThisFileP,
-						&numCharsThisFileP
-					);
-					fflush(fp);
-					fclose(fp);
-					exit(EXIT_FAILURE);
-				}
+					neighbours_error_tooMany(tlngP,  rhId1,  rhId2);
 
 				twoRhombi_Neighbourify(tlngP,  rhId1,  rhId2);
 			}  // So close that must be neighbours
@@ -223,4 +184,465 @@ void neighbours_populate(Tiling * const tlngP)
 		}  // for( rhId2 ... )
 	}  // for( rhId1 ... )
 
-}  // neighbours_populate
+}  // neighbours_populate_sorted()
+
+
+// Edges numbered 0 to 3: north-east, north-west, south-east, south-west.
+static inline bool rhombus_edgeTouchesN(int8_t const edgeNum)  {return edgeNum < 2;}
+static inline bool rhombus_edgeTouchesE(int8_t const edgeNum)  {return 0 == edgeNum % 2;}
+
+static inline XY rhombus_edgeMidpoint(Tiling const * const tlngP,  Rhombus const * const rhP,  int8_t const edgeNum)
+{
+	XY const xyNS = rhombus_edgeTouchesN(edgeNum) ? rhombus_north(tlngP, rhP) : rhombus_south(tlngP, rhP);
+	XY const xyEW = rhombus_edgeTouchesE(edgeNum) ? rhombus_east(tlngP, rhP)  : rhombus_west(tlngP, rhP);
+#if ! CompactRhombi
+	(void)tlngP;  // Read only by the CompactRhombi rhombus_north() etc., which derive vertices.
+#endif
+	return (XY){.x = (xyNS.x + xyEW.x) / 2,  .y = (xyNS.y + xyEW.y) / 2};
+}  // rhombus_edgeMidpoint()
+
+#if ExactCoordinates
+// Twice the midpoint, so exact.
+static inline Lattice rhombus_edgeSumExact(Rhombus const * const rhP,  int8_t const edgeNum)
+{
+	return lattice_add(
+		rhombus_edgeTouchesN(edgeNum) ? rhombus_northExact(rhP) : rhombus_southExact(rhP),
+		rhombus_edgeTouchesE(edgeNum) ? rhombus_eastExact(rhP)  : rhombus_westExact(rhP)
+	);
+}  // rhombus_edgeSumExact()
+#endif
+
+
+// Shared edges have the same midpoint. So one pass, each rhombus's four edge midpoints being looked up in a
+// SpatialHash of the edges of earlier rhombi, the match giving the edges directly. To give the same result as
+// neighbours_populate_sorted(), each rhombus's matches are neighbourified in decreasing rhId of the other.
+static void neighbours_populate_hashed(Tiling * const tlngP)
+{
+	RhombId        rhId1, rhId2;
+	Rhombus      * rhP1,  * rhP2;
+	int8_t         edgeNum1, edgeNum2, matchNum, numMatches, sortNum;
+	RhombId        matchRhId[4];
+	int8_t         matchEdge1[4], matchEdge2[4];
+	long int       candidates[8], numCandidates, candidateNum;
+	XY             midpoint1;
+	double const   thresholdSame = tlngP->edgeLength * 0.01 ;  // Distinct edges' midpoints are at least edgeLength * Sin(18 degrees) apart.
+	SpatialHash    sh;
+
+	spatialHash_init(&sh,  2 * thresholdSame,  4 * (tlngP->numFats + tlngP->numThins));
+
+	for( rhId1 = 0  ;  rhId1 < tlngP->numFats + tlngP->numThins  ;  rhId1++ )
+	{
+		rhP1 = &(tlngP->rhombi[rhId1]);
+		numMatches = 0;
+		for( edgeNum1 = 0  ;  edgeNum1 < 4  ;  edgeNum1 ++ )
+		{
+			midpoint1 = rhombus_edgeMidpoint(tlngP,  rhP1,  edgeNum1);
+			numCandidates = spatialHash_candidates(&sh,  midpoint1,  candidates,  8);
+			for( candidateNum = 0  ;  candidateNum < numCandidates  &&  candidateNum < 8  ;  candidateNum ++ )
+			{
+				rhId2    = candidates[candidateNum] / 4;
+				edgeNum2 = candidates[candidateNum] % 4;
+				rhP2 = &(tlngP->rhombi[rhId2]);
+#if ExactCoordinates
+				if( ! lattice_same( rhombus_edgeSumExact(rhP1,  edgeNum1),  rhombus_edgeSumExact(rhP2,  edgeNum2) ) )
+					continue;
+#else
+				XY const midpoint2 = rhombus_edgeMidpoint(tlngP,  rhP2,  edgeNum2);
+				if( fabs(midpoint1.x - midpoint2.x) > thresholdSame  ||  fabs(midpoint1.y - midpoint2.y) > thresholdSame )
+					continue;
+#endif
+				if( numMatches >= 4 )
+					neighbours_error_tooMany(tlngP,  rhId1,  rhId2);
+				matchRhId[numMatches]  = rhId2;
+				matchEdge1[numMatches] = edgeNum1;
+				matchEdge2[numMatches] = edgeNum2;
+				numMatches ++;
+			}  // for( candidateNum ... )
+		}  // for( edgeNum1 ... )
+
+		// Insertion sort, decreasing rhId2, as found by neighbours_populate_sorted().
+		for( matchNum = 1  ;  matchNum < numMatches  ;  matchNum ++ )
+			for( sortNum = matchNum  ;  sortNum > 0  &&  matchRhId[sortNum - 1] < matchRhId[sortNum]  ;  sortNum -- )
+			{
+				rhId2 = matchRhId[sortNum];   matchRhId[sortNum]  = matchRhId[sortNum - 1];   matchRhId[sortNum - 1]  = rhId2;
+				edgeNum2 = matchEdge1[sortNum];  matchEdge1[sortNum] = matchEdge1[sortNum - 1];  matchEdge1[sortNum - 1] = edgeNum2;
+				edgeNum2 = matchEdge2[sortNum];  matchEdge2[sortNum] = matchEdge2[sortNum - 1];  matchEdge2[sortNum - 1] = edgeNum2;
+			}
+
+		for( matchNum = 0  ;  matchNum < numMatches  ;  matchNum ++ )
+		{
+			rhId2 = matchRhId[matchNum];
+			if( tlngP->rhombi[rhId1].numNeighbours >= 4
+			||  tlngP->rhombi[rhId2].numNeighbours >= 4 )
+				neighbours_error_tooMany(tlngP,  rhId1,  rhId2);
+			twoRhombi_Link(
+				tlngP,
+				rhId1,  rhombus_edgeTouchesN(matchEdge1[matchNum]),  rhombus_edgeTouchesE(matchEdge1[matchNum]),
+				rhId2,  rhombus_edgeTouchesN(matchEdge2[matchNum]),  rhombus_edgeTouchesE(matchEdge2[matchNum])
+			);
+		}  // for( matchNum ... )
+
+		for( edgeNum1 = 0  ;  edgeNum1 < 4  ;  edgeNum1 ++ )
+			spatialHash_insert(&sh,  rhombus_edgeMidpoint(tlngP,  rhP1,  edgeNum1),  4 * rhId1 + edgeNum1);
+	}  // for( rhId1 ... )
+
+	spatialHash_free(&sh);
+}  // neighbours_populate_hashed()
+
+
+void neighbours_populate(Tiling * const tlngP)
+{
+	RhombId rhId;
+
+	for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId++ )
+	{
+		tlngP->rhombi[rhId].numNeighbours = 0;  // Reset previous neighbouring, if any
+		tlngP->rhombi[rhId].neighbours[0].rhId = -1;
+		tlngP->rhombi[rhId].neighbours[1].rhId = -1;
+		tlngP->rhombi[rhId].neighbours[2].rhId = -1;
+		tlngP->rhombi[rhId].neighbours[3].rhId = -1;
+	}
+
+	rhombi_sort(tlngP,  &rhombiGt_ByY,  false);
+
+	if( neighboursByHashQ(tlngP) )
+		neighbours_populate_hashed(tlngP);
+	else
+		neighbours_populate_sorted(tlngP);
+}  // neighbours_populate()
+
+
+
+// Neighbours within the children of one ancestor. Edges numbered as rhombus_edgeMidpoint().
+typedef struct {int8_t childNum0;  int8_t edgeNum0;  int8_t childNum1;  int8_t edgeNum1;} ChildLink;
+static ChildLink const childLinks_Fat[5] = {
+	{0, 0,  3, 0},
+	{0, 1,  4, 1},
+	{1, 1,  2, 0},
+	{1, 3,  3, 2},
+	{2, 2,  4, 3}
+};
+static ChildLink const childLinks_Thin[3] = {
+	{0, 1,  2, 1},
+	{1, 0,  3, 0},
+	{2, 3,  3, 2}
+};
+
+// Neighbours between children of two ancestors sharing an edge, other than via the child straddling that edge.
+typedef struct {Physique physique0;  int8_t edgeNum0;  ChildLink link;  Physique physique1;  int8_t edgeNum1;} AncestorsLink;
+static AncestorsLink const ancestorsLinks[3] = {
+	{Fat,  0,  {0, 3,  0, 2},  Fat ,  1},
+	{Fat,  0,  {0, 3,  1, 2},  Thin,  0},
+	{Fat,  1,  {0, 2,  0, 3},  Thin,  1}
+};
+
+
+static inline int8_t rhombus_edgeNum(bool const touchesN,  bool const touchesE)
+{
+	return (touchesN ? 0 : 2)  +  (touchesE ? 0 : 1);
+}  // rhombus_edgeNum()
+
+
+static void neighbours_inherit_link(
+	Tiling * const tlngP,
+	RhombId const rhId0,  int8_t const edgeNum0,
+	RhombId const rhId1,  int8_t const edgeNum1
+)
+{
+	if( rhId0 < 0  ||  rhId1 < 0 )
+		return;  // Not kept by rhombus_keep()
+	if( tlngP->rhombi[rhId0].numNeighbours >= 4  ||  tlngP->rhombi[rhId1].numNeighbours >= 4 )
+		neighbours_error_tooMany(tlngP,  rhId0,  rhId1);
+	twoRhombi_Link(
+		tlngP,
+		rhId0,  rhombus_edgeTouchesN(edgeNum0),  rhombus_edgeTouchesE(edgeNum0),
+		rhId1,  rhombus_edgeTouchesN(edgeNum1),  rhombus_edgeTouchesE(edgeNum1)
+	);
+}  // neighbours_inherit_link()
+
+
+// Order of a rhombus's neighbours as made by neighbours_populate(): those with lower rhId in decreasing
+// order, then those with higher rhId in increasing order.
+static void neighbours_order_canonical_one(Tiling * const tlngP,  RhombId const rhId)
+{
+	Rhombus * const rhP = &(tlngP->rhombi[rhId]);
+	Neighbour nghbr;
+	int8_t    nghbrNum, sortNum;
+
+	for( nghbrNum = 1  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum ++ )
+		for( sortNum = nghbrNum  ;  sortNum > 0  ;  sortNum -- )
+		{
+			RhombId const rhIdPrev = rhP->neighbours[sortNum - 1].rhId;
+			RhombId const rhIdThis = rhP->neighbours[sortNum    ].rhId;
+			bool const inOrder = ( rhIdPrev < rhId
+				?  (rhIdThis > rhId  ||  rhIdThis < rhIdPrev)
+				:  (rhIdThis > rhId  &&  rhIdThis > rhIdPrev) );
+			if( inOrder )
+				break;
+			nghbr = rhP->neighbours[sortNum - 1];
+			rhP->neighbours[sortNum - 1] = rhP->neighbours[sortNum];
+			rhP->neighbours[sortNum] = nghbr;
+		}  // for( sortNum ... )
+}  // neighbours_order_canonical_one()
+
+
+// Sets rhId's neighbours' nghbrsNghbrNum to match their neighbours' order.
+void neighbours_nghbrsNghbrNum_one(Tiling * const tlngP,  RhombId const rhId)
+{
+	Rhombus * const rhP = &(tlngP->rhombi[rhId]);
+	int8_t    nghbrNum, nnn;
+
+	for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum ++ )
+	{
+		Rhombus const * const rhP_Other = &(tlngP->rhombi[ rhP->neighbours[nghbrNum].rhId ]);
+		for( nnn = 0  ;  nnn < rhP_Other->numNeighbours  &&  rhP_Other->neighbours[nnn].rhId != rhId  ;  nnn ++ )
+			;
+		neighbour_nghbrsNghbrNum_set(rhP,  nghbrNum,  nnn);
+	}  // for( nghbrNum ... )
+}  // neighbours_nghbrsNghbrNum_one()
+
+
+// Each rhombus's neighbours as neighbours_order_canonical_one(), then nghbrsNghbrNum set to match.
+static void neighbours_order_canonical(Tiling * const tlngP)
+{
+	RhombId   rhId;
+
+	for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+		neighbours_order_canonical_one(tlngP,  rhId);
+	for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+		neighbours_nghbrsNghbrNum_one(tlngP,  rhId);
+}  // neighbours_order_canonical()
+
+
+// Instead of neighbours_populate(), for a descendant made by edge ownership: links follow from the ancestor's.
+// childRhIds[5 * ancestor's rhId + childNum] is as set by rhombus_append_descendants(), and is altered here.
+// Ends, as does neighbours_populate(), with the rhombi sorted by y.
+void neighbours_inherit(Tiling * const tlngDescendantP,  Tiling const * const tlngAncestorP,  RhombId * const childRhIds)
+{
+	RhombId           rhId_A, rhId_B;
+	RhombId         * childRhIdP_A,  * childRhIdP_B;
+	Rhombus const   * rhP_A,  * rhP_B;
+	int8_t            nghbrNum, edgeNum_A, edgeNum_B, linkNum;
+	ChildLink const * linkP;
+	long int const    numAncestors = tlngAncestorP->numFats + tlngAncestorP->numThins;
+
+	// Children straddling an edge owned by the neighbour: take its rhId. Unless the neighbour, outside the region of
+	// interest, made no children, in which case A owned the edge, so the neighbour is given A's.
+	for( rhId_A = 0  ;  rhId_A < numAncestors  ;  rhId_A ++ )
+	{
+		rhP_A = &(tlngAncestorP->rhombi[rhId_A]);
+		for( nghbrNum = 0  ;  nghbrNum < rhP_A->numNeighbours  ;  nghbrNum ++ )
+		{
+			rhId_B = rhP_A->neighbours[nghbrNum].rhId;
+			if( rhId_B > rhId_A )
+				continue;  // Owned by A
+			rhP_B = &(tlngAncestorP->rhombi[rhId_B]);
+			childRhIdP_A = childRhIds + 5 * rhId_A  +  rhombus_childOnEdge(rhP_A->physique,  rhP_A->neighbours[nghbrNum].touchesN,  rhP_A->neighbours[nghbrNum].touchesE);
+			childRhIdP_B = childRhIds + 5 * rhId_B  +  rhombus_childOnEdge(
+				rhP_B->physique,
+				rhP_B->neighbours[ neighbour_nghbrsNghbrNum(rhP_A, nghbrNum) ].touchesN,
+				rhP_B->neighbours[ neighbour_nghbrsNghbrNum(rhP_A, nghbrNum) ].touchesE
+			);
+			if( *childRhIdP_A < 0 )
+				*childRhIdP_A = *childRhIdP_B;
+			else
+				*childRhIdP_B = *childRhIdP_A;
+		}  // for( nghbrNum ... )
+	}  // for( rhId_A ... )
+
+	for( rhId_A = 0  ;  rhId_A < numAncestors  ;  rhId_A ++ )
+	{
+		rhP_A = &(tlngAncestorP->rhombi[rhId_A]);
+
+		// Within one ancestor
+		for( linkNum = 0  ;  linkNum < (Fat == rhP_A->physique ? 5 : 3)  ;  linkNum ++ )
+		{
+			linkP = (Fat == rhP_A->physique ? childLinks_Fat : childLinks_Thin) + linkNum;
+			neighbours_inherit_link(
+				tlngDescendantP,
+				childRhIds[5 * rhId_A + linkP->childNum0],  linkP->edgeNum0,
+				childRhIds[5 * rhId_A + linkP->childNum1],  linkP->edgeNum1
+			);
+		}  // for( linkNum ... )
+
+		// Across an edge, each pair of ancestors once
+		for( nghbrNum = 0  ;  nghbrNum < rhP_A->numNeighbours  ;  nghbrNum ++ )
+		{
+			rhId_B = rhP_A->neighbours[nghbrNum].rhId;
+			if( rhId_B < rhId_A )
+				continue;
+			rhP_B = &(tlngAncestorP->rhombi[rhId_B]);
+			edgeNum_A = rhombus_edgeNum(rhP_A->neighbours[nghbrNum].touchesN,  rhP_A->neighbours[nghbrNum].touchesE);
+			edgeNum_B = rhombus_edgeNum(
+				rhP_B->neighbours[ neighbour_nghbrsNghbrNum(rhP_A, nghbrNum) ].touchesN,
+				rhP_B->neighbours[ neighbour_nghbrsNghbrNum(rhP_A, nghbrNum) ].touchesE
+			);
+			for( linkNum = 0  ;  linkNum < 3  ;  linkNum ++ )
+			{
+				AncestorsLink const * const alP = &(ancestorsLinks[linkNum]);
+				if( alP->physique0 == rhP_A->physique  &&  alP->edgeNum0 == edgeNum_A  &&  alP->physique1 == rhP_B->physique  &&  alP->edgeNum1 == edgeNum_B )
+					neighbours_inherit_link(
+						tlngDescendantP,
+						childRhIds[5 * rhId_A + alP->link.childNum0],  alP->link.edgeNum0,
+						childRhIds[5 * rhId_B + alP->link.childNum1],  alP->link.edgeNum1
+					);
+				else if( alP->physique0 == rhP_B->physique  &&  alP->edgeNum0 == edgeNum_B  &&  alP->physique1 == rhP_A->physique  &&  alP->edgeNum1 == edgeNum_A )
+					neighbours_inherit_link(
+						tlngDescendantP,
+						childRhIds[5 * rhId_B + alP->link.childNum0],  alP->link.edgeNum0,
+						childRhIds[5 * rhId_A + alP->link.childNum1],  alP->link.edgeNum1
+					);
+			}  // for( linkNum ... )
+		}  // for( nghbrNum ... )
+	}  // for( rhId_A ... )
+
+	rhombi_sort(tlngDescendantP,  &rhombiGt_ByY,  true);
+	neighbours_order_canonical(tlngDescendantP);
+}  // neighbours_inherit()
+
+
+
+// Whether rhP has no neighbour on edge edgeNum, numbered as rhombus_edgeMidpoint().
+static inline bool rhombus_edgeOpen(Rhombus const * const rhP,  int8_t const edgeNum)
+{
+	int8_t nghbrNum;
+	for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum ++ )
+		if( rhP->neighbours[nghbrNum].touchesN == rhombus_edgeTouchesN(edgeNum)
+		&&  rhP->neighbours[nghbrNum].touchesE == rhombus_edgeTouchesE(edgeNum) )
+			return false;
+	return true;
+}  // rhombus_edgeOpen()
+
+
+// For changing neighbours locally, as by holesFill(). *shP holds edges without a neighbour, as 4 * rhId + edgeNum. This adds rhId's.
+// The hash's pitch should be 2 * 0.01 * edgeLength, as neighbours_populate_hashed().
+void neighbours_openEdges_insert(Tiling const * const tlngP,  SpatialHash * const shP,  RhombId const rhId)
+{
+	Rhombus const * const rhP = &(tlngP->rhombi[rhId]);
+	int8_t edgeNum;
+
+	for( edgeNum = 0  ;  edgeNum < 4  ;  edgeNum ++ )
+		if( rhombus_edgeOpen(rhP,  edgeNum) )
+			spatialHash_insert(shP,  rhombus_edgeMidpoint(tlngP,  rhP,  edgeNum),  4 * rhId + edgeNum);
+}  // neighbours_openEdges_insert()
+
+
+// Links rhId with each rhombus in *shP sharing one of its open edges, such edges having since closed being ignored.
+// Neighbours are in the order found: neighbours_canonical() restores that of neighbours_populate().
+void neighbours_openEdges_link(Tiling * const tlngP,  SpatialHash const * const shP,  RhombId const rhId)
+{
+	RhombId        rhId2;
+	Rhombus      * rhP2;
+	int8_t         edgeNum, edgeNum2;
+	long int       candidates[8], numCandidates, candidateNum;
+	XY             midpoint;
+	double const   thresholdSame = tlngP->edgeLength * 0.01 ;
+
+	for( edgeNum = 0  ;  edgeNum < 4  ;  edgeNum ++ )
+	{
+		if( ! rhombus_edgeOpen(&(tlngP->rhombi[rhId]),  edgeNum) )
+			continue;
+		midpoint = rhombus_edgeMidpoint(tlngP,  &(tlngP->rhombi[rhId]),  edgeNum);
+		numCandidates = spatialHash_candidates(shP,  midpoint,  candidates,  8);
+		for( candidateNum = 0  ;  candidateNum < numCandidates  &&  candidateNum < 8  ;  candidateNum ++ )
+		{
+			rhId2    = candidates[candidateNum] / 4;
+			edgeNum2 = candidates[candidateNum] % 4;
+			rhP2 = &(tlngP->rhombi[rhId2]);
+			if( rhId2 == rhId  ||  ! rhombus_edgeOpen(rhP2,  edgeNum2) )
+				continue;
+#if ExactCoordinates
+			if( ! lattice_same( rhombus_edgeSumExact(&(tlngP->rhombi[rhId]),  edgeNum),  rhombus_edgeSumExact(rhP2,  edgeNum2) ) )
+				continue;
+#else
+			XY const midpoint2 = rhombus_edgeMidpoint(tlngP,  rhP2,  edgeNum2);
+			if( fabs(midpoint.x - midpoint2.x) > thresholdSame  ||  fabs(midpoint.y - midpoint2.y) > thresholdSame )
+				continue;
+#endif
+			if( tlngP->rhombi[rhId].numNeighbours >= 4  ||  rhP2->numNeighbours >= 4 )
+				neighbours_error_tooMany(tlngP,  rhId,  rhId2);
+			twoRhombi_Link(
+				tlngP,
+				rhId,   rhombus_edgeTouchesN(edgeNum),   rhombus_edgeTouchesE(edgeNum),
+				rhId2,  rhombus_edgeTouchesN(edgeNum2),  rhombus_edgeTouchesE(edgeNum2)
+			);
+			break;  // This edge now closed.
+		}  // for( candidateNum ... )
+	}  // for( edgeNum ... )
+}  // neighbours_openEdges_link()
+
+
+// Returns a rhombus in *shP that is the same as rhId, else -1. A duplicate being made into what seemed a gap, an edge of the
+// original was open there when it was inserted, so is found at one of the duplicate's edges.
+RhombId neighbours_openEdges_duplicate(Tiling const * const tlngP,  SpatialHash const * const shP,  RhombId const rhId)
+{
+	Rhombus const * const rhP = &(tlngP->rhombi[rhId]);
+	Rhombus const *       rhP2;
+	int8_t                edgeNum;
+	long int              candidates[8], numCandidates, candidateNum;
+	double const          thresholdSame = tlngP->edgeLength * 0.01 ;
+
+	for( edgeNum = 0  ;  edgeNum < 4  ;  edgeNum ++ )
+	{
+		numCandidates = spatialHash_candidates(shP,  rhombus_edgeMidpoint(tlngP,  rhP,  edgeNum),  candidates,  8);
+		for( candidateNum = 0  ;  candidateNum < numCandidates  &&  candidateNum < 8  ;  candidateNum ++ )
+		{
+			rhP2 = &(tlngP->rhombi[ candidates[candidateNum] / 4 ]);
+			if( rhP2 == rhP  ||  rhP2->physique != rhP->physique )
+				continue;
+#if ExactCoordinates
+			if( lattice_same( lattice_add(rhombus_northExact(rhP),  rhombus_southExact(rhP)),  lattice_add(rhombus_northExact(rhP2),  rhombus_southExact(rhP2)) ) )
+				return candidates[candidateNum] / 4;
+#else
+			if( fabs(rhombus_hotCentre(tlngP, rhId).x - rhombus_hotCentre(tlngP, candidates[candidateNum] / 4).x) <= thresholdSame
+			&&  fabs(rhombus_hotCentre(tlngP, rhId).y - rhombus_hotCentre(tlngP, candidates[candidateNum] / 4).y) <= thresholdSame )
+				return candidates[candidateNum] / 4;
+#endif
+		}  // for( candidateNum ... )
+	}  // for( edgeNum ... )
+	return -1;
+}  // neighbours_openEdges_duplicate()
+
+
+// After neighbours changed locally: rhombi sorted by y, and each's neighbours in the order of neighbours_populate().
+// If the rhombi before numSorted were already so, as after neighbours_populate() and only appending, only those after are sorted,
+// and only their neighbourhoods reordered. Else, or if numSorted is 0, all.
+void neighbours_canonical(Tiling * const tlngP,  RhombId const numSorted)
+{
+	long int const numTail = tlngP->numFats + tlngP->numThins - numSorted;
+	RhombId * tailRhIdsNew;
+	RhombId   tailNum,  rhId;
+	int8_t    nghbrNum,  nghbrNum2;
+
+	tailRhIdsNew = (numSorted > 0  &&  numTail > 0  ?  malloc( numTail * sizeof(RhombId) )  :  NULL);
+	if( NULL == tailRhIdsNew  ||  ! rhombi_sortTail_ByY(tlngP,  numSorted,  tailRhIdsNew) )
+	{
+		free(tailRhIdsNew);
+		rhombi_sort(tlngP,  &rhombiGt_ByY,  true);
+		neighbours_order_canonical(tlngP);
+		return;
+	}  // Not just a tail
+
+	// Old rhombi kept their relative order, so only the new and their neighbours need reordering; and nghbrsNghbrNum changes only
+	// for them and their neighbours.
+	for( tailNum = 0  ;  tailNum < numTail  ;  tailNum ++ )
+	{
+		rhId = tailRhIdsNew[tailNum];
+		neighbours_order_canonical_one(tlngP,  rhId);
+		for( nghbrNum = 0  ;  nghbrNum < tlngP->rhombi[rhId].numNeighbours  ;  nghbrNum ++ )
+			neighbours_order_canonical_one(tlngP,  tlngP->rhombi[rhId].neighbours[nghbrNum].rhId);
+	}  // for( tailNum ... )
+	for( tailNum = 0  ;  tailNum < numTail  ;  tailNum ++ )
+	{
+		rhId = tailRhIdsNew[tailNum];
+		neighbours_nghbrsNghbrNum_one(tlngP,  rhId);
+		for( nghbrNum = 0  ;  nghbrNum < tlngP->rhombi[rhId].numNeighbours  ;  nghbrNum ++ )
+		{
+			RhombId const rhId_Nghbr = tlngP->rhombi[rhId].neighbours[nghbrNum].rhId;
+			neighbours_nghbrsNghbrNum_one(tlngP,  rhId_Nghbr);
+			for( nghbrNum2 = 0  ;  nghbrNum2 < tlngP->rhombi[rhId_Nghbr].numNeighbours  ;  nghbrNum2 ++ )
+				neighbours_nghbrsNghbrNum_one(tlngP,  tlngP->rhombi[rhId_Nghbr].neighbours[nghbrNum2].rhId);
+		}  // for( nghbrNum ... )
+	}  // for( tailNum ... )
+	free(tailRhIdsNew);
+}  // neighbours_canonical()
@@ -17,7 +17,7 @@ void pathStats_populate(Tiling * const tlngP)
 	tlngP->numPathStats = 0;
 
 	tlngP->pathStats_NumMax = 1  +  2 * ( tlngP->numFats > 0  ?  (long int)ceil(pow(1 + tlngP->numFats, 0.6))  :  0 );
-	tlngP->pathStat = malloc( tlngP->pathStats_NumMax  *  sizeof(PathStats) );
+	tlngP->pathStat = bigArray_alloc(tlngP,  tlngP->pathStats_NumMax,  sizeof(PathStats),  "pathStat",  &(tlngP->pathStat_Mapped));
 	if(NULL == tlngP->pathStat)
 	{
 		fprintf(stderr, "pathStats_populate: malloc() failed with tilingId=%" PRIi8 ", pathStats_NumMax=%li\n", tlngP->tilingId, tlngP->pathStats_NumMax);
@@ -5,36 +5,50 @@
 #include "penrose.h"
 
 // Negative return means non-existent. Re direction: true ==> next; false ==> prev.
-RhombId NextInPath_RhId(const Rhombus * const rhombi,  const Rhombus * const rhThisP, long int const pathLength,  bool const direction)
+// The links are stored by paths_populate(), so no search of the neighbours is needed.
+RhombId NextInPath_RhId(const Rhombus * const rhThisP,  bool const direction)
 {
-	int8_t  nghbrNum;
-	RhombId rhId_Next;
-	const Rhombus * rhNextP;
+	return( direction ? rhThisP->rhId_PathNext : rhThisP->rhId_PathPrev );
+}  // NextInPath_RhId()
+
+
 
-	if( rhThisP->physique != Fat )
-		return(-1);
+// Reverses pathRhIds[first ... last] in place. Used, in two or three applications, to rotate and reflect a closed path's list.
+static void pathRhIds_reverse(RhombId * const pathRhIds,  long int first,  long int last)
+{
+	RhombId rhId_Temp;
 
-	for( nghbrNum = 0  ;  nghbrNum < rhThisP->numNeighbours  ;  nghbrNum++ )
+	for(  ;  first < last  ;  first++, last-- )
 	{
-		rhId_Next = rhThisP->neighbours[nghbrNum].rhId;
-		rhNextP = &(rhombi[rhId_Next]);
-		if( rhNextP->physique != Fat )
-			continue;
+		rhId_Temp = pathRhIds[first];
+		pathRhIds[first] = pathRhIds[last];
+		pathRhIds[last] = rhId_Temp;
+	}  // for( first, last ... )
+}  // pathRhIds_reverse()
+
 
-		if( direction )
-		{
-			if( rhNextP->withinPathNum == (rhThisP->withinPathNum              + 1) % pathLength )
-				return(rhId_Next);
-		}
-		else
-		{
-			if( rhNextP->withinPathNum == (rhThisP->withinPathNum + pathLength - 1) % pathLength )
-				return(rhId_Next);
-		}
-	}  // for( nghbrNum ...)
 
+// Square of the distance between two points.
+static inline double distance2(XY const xy0,  XY const xy1)
+{
+	return (xy0.x - xy1.x) * (xy0.x - xy1.x)  +  (xy0.y - xy1.y) * (xy0.y - xy1.y);
+}  // distance2()
+
+
+
+// The fat neighbouring rhP other than rhId_Prev, or -1 if none. A fat has at most two fat neighbours, those either side of it in its path.
+static inline RhombId fatNeighbour_other(Tiling const * const tlngP,  const Rhombus * const rhP,  RhombId const rhId_Prev)
+{
+	int8_t nghbrNum;
+#if ! CompactRhombi
+	(void)tlngP;  // Read only by the CompactRhombi neighbour_physique(), a neighbour's physique not then being in its Neighbour record.
+#endif
+
+	for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum++ )
+		if( Fat == neighbour_physique(tlngP, &(rhP->neighbours[nghbrNum]))  &&  rhP->neighbours[nghbrNum].rhId != rhId_Prev )
+			return( rhP->neighbours[nghbrNum].rhId );
 	return(-1);
-}  // NextInPath_RhId()
+}  // fatNeighbour_other()
 
 
 
@@ -43,19 +57,16 @@ RhombId NextInPath_RhId(const Rhombus * const rhombi,  const Rhombus * const rhT
 // Negative means don't want; positive is new wanted distance.
 // This caused feedback to Apple: https://feedbackassistant.apple.com/feedback/15322282
 inline static double rhWithinPathMoreSpecial(
-	bool            const wantClosest,
-	const Path    * const pathP,
-	const Rhombus * const rhNewP,
-	const Rhombus * const rhOldP,
-	const double distance2old,
-	const double distance2Epsilon,
-	const double distanceEpsilon
+	bool   const wantClosest,
+	XY     const pathCentre,
+	XY     const centreNew,
+	XY     const centreOld,
+	double const distance2old,
+	double const distance2Epsilon,
+	double const distanceEpsilon
 )
 {
-	const double dist2New = pow(rhNewP->centre.x - pathP->centre.x,  2) + pow(rhNewP->centre.y - pathP->centre.y,  2) ;
-
-	if(rhNewP == rhOldP)
-		return dist2New;  // This special used to generate distance with initial setting.
+	const double dist2New = distance2(centreNew,  pathCentre) ;
 
 	if(wantClosest)
 	{
@@ -67,9 +78,9 @@ inline static double rhWithinPathMoreSpecial(
 		if( dist2New <= distance2old - distance2Epsilon )  return -1;        // Definitely closer
 		if( dist2New >  distance2old + distance2Epsilon )  return dist2New;  // Definitely further. Failing this, distance a tie to within machine precision.
 	}
-	if( rhNewP->centre.x < pathP->centre.x - distanceEpsilon  ||  rhNewP->centre.y < pathP->centre.y - distanceEpsilon )  return -1;        // New not 1st quadrant
-	if( rhOldP->centre.x < pathP->centre.x - distanceEpsilon  ||  rhOldP->centre.y < pathP->centre.y - distanceEpsilon )  return dist2New;  // New is 1st quadrant, old not
-	return( rhNewP->centre.y > rhOldP->centre.y ? dist2New : -1 );  // Both 1st quadrant, choose more northerly
+	if( centreNew.x < pathCentre.x - distanceEpsilon  ||  centreNew.y < pathCentre.y - distanceEpsilon )  return -1;        // New not 1st quadrant
+	if( centreOld.x < pathCentre.x - distanceEpsilon  ||  centreOld.y < pathCentre.y - distanceEpsilon )  return dist2New;  // New is 1st quadrant, old not
+	return( centreNew.y > centreOld.y ? dist2New : -1 );  // Both 1st quadrant, choose more northerly
 }  // rhWithinPathMoreSpecial()
 
 
@@ -92,13 +103,20 @@ int8_t pathClosedTypeNum(bool pathClosed, long int pathLength, bool pointy)
 void paths_populate(Tiling * const tlngP)
 {
 	register RhombId  rhId_This;
-	RhombId           rhId_PathStart, rhId_Prev, rhId_Next, rhId_PathStart_Better;
-	PathId            pathId, pathRhPathRhombNumClosest, rhPathNum;
+	RhombId           rhId_PathStart, rhId_Prev, rhId_Next;
+	RhombId           numFatsListed = 0;  // Length of the prefix of tlngP->pathRhIds[] given to paths so far
+	RhombId           *pathRhIds;  // This path's part of tlngP->pathRhIds[], which is also where it is listed while being traced
+	long int          numTracedFirst;  // Fats traced before the first dead end, including rhId_PathStart. Negative ==> no dead end yet.
+	PathId            rhPathNum, rhPathNumClosest;
 	Rhombus           *rhThisP;
 	Path              *pathThisP;
 	int8_t            nghbrNum;
-	bool              noNewNeighbours, isClockwise, orientationFound;
-	double            thisPathSumX, thisPathSumY, dist2Temp, dist2Closest, dist2Furthest;
+	bool              allFourNeighbours, isClockwise, orientationFound;
+	long int          k;
+	RhombiOrder       orderByY;
+	RhombiOrder       *orderByYP = NULL;  // Paths are found in y order, so the same if tlngP->rhombi_Spatial.
+	XY                centrePrev = {0, 0};
+	double            thisPathSumX, thisPathSumY, twiceArea, dist2Temp, dist2Closest, dist2Furthest;
 	double const      distance2Epsilon = pow(tlngP->edgeLength / 16, 2);  // Machine-precision allowance for Pythagorean square of distance
 	double const      distanceEpsilon = tlngP->edgeLength / 256;          // Can be in 1st quadrant with x or y slightly negative, by machine precision
 
@@ -121,7 +139,7 @@ void paths_populate(Tiling * const tlngP)
 	if( tlngP->path_NumMax > tlngP->numFats )
 		tlngP->path_NumMax = tlngP->numFats ;
 
-	tlngP->path = malloc( tlngP->path_NumMax  *  sizeof(Path) );
+	tlngP->path = bigArray_alloc(tlngP,  tlngP->path_NumMax,  sizeof(Path),  "path",  &(tlngP->path_Mapped));
 	if( NULL == tlngP->path )
 	{
 		fprintf(stderr, "paths_populate(): !!! NULL == tlngP->path !!!\n");
@@ -129,11 +147,26 @@ void paths_populate(Tiling * const tlngP)
 		exit(EXIT_FAILURE);
 	}  // if( NULL == tlngP->path )
 
+	tlngP->pathRhIds = bigArray_alloc(tlngP,  tlngP->numFats,  sizeof(RhombId),  "pathRhIds",  &(tlngP->pathRhIds_Mapped));
+	if( NULL == tlngP->pathRhIds )
+	{
+		fprintf(stderr, "paths_populate(): !!! NULL == tlngP->pathRhIds !!!\n");
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}  // if( NULL == tlngP->pathRhIds )
+
 	for( rhId_PathStart = 0;  rhId_PathStart < tlngP->numFats + tlngP->numThins ; rhId_PathStart++ )
 		tlngP->rhombi[rhId_PathStart].pathId = -1 ;
 
-	for( rhId_PathStart = 0;  rhId_PathStart < tlngP->numFats + tlngP->numThins ; rhId_PathStart++ )
+	if( tlngP->rhombi_Spatial )
 	{
+		rhombiOrder_make(tlngP,  &rhombiGt_ByY,  &orderByY);
+		orderByYP = &orderByY;
+	}  // rhombi_Spatial
+
+	for( k = 0;  k < tlngP->numFats + tlngP->numThins ; k++ )
+	{
+		rhId_PathStart = rhombiOrder_rhId(orderByYP, k);
 		if( Fat != tlngP->rhombi[rhId_PathStart].physique
 		||  tlngP->rhombi[rhId_PathStart].pathId >= 0 )  // rhId_PathStart already has path assigned
 			continue;
@@ -155,163 +188,113 @@ void paths_populate(Tiling * const tlngP)
 		pathThisP->orientationDegrees  = DBL_MAX ;
 		pathThisP->rhId_ThinWithin_First = tlngP->numFats + tlngP->numThins - 1;
 		pathThisP->rhId_ThinWithin_Last  = 0;
-
-		// Path either open or closed. Let's follow path until re-reach start, or reach dead end, revealing whether closed and if not, a sensible beginning place.
-
-		tlngP->rhombi[rhId_PathStart].pathId = pathThisP->pathId;
-
-		rhId_Prev = -1;
-		rhId_This = rhId_PathStart;
-		rhId_Next = rhId_PathStart;
-		while(true)
-		{
-			rhThisP  =  &(tlngP->rhombi[ rhId_This ]) ;
-
-			noNewNeighbours = true ;
-			for( nghbrNum = 0  ;  nghbrNum < rhThisP->numNeighbours  ;  nghbrNum++ )
-			{
-				rhId_Next = rhThisP->neighbours[nghbrNum].rhId ;
-				if( rhId_Next >= 0  &&  rhId_Next != rhId_Prev  &&  Fat == tlngP->rhombi[rhId_Next].physique )
-				{
-					if(rhId_Next == rhId_PathStart)
-						{pathThisP->pathClosed = true;  rhId_PathStart_Better = rhId_PathStart;  goto know_rhIdPathStart_pathClosed;}  // goto used as a multi-loop break.
-					else
-						{noNewNeighbours = false;  break;}
-				}
-			}  // for nghbrNum
-			if( noNewNeighbours )
-				{pathThisP->pathClosed = false;  rhId_PathStart_Better = rhId_This;  goto know_rhIdPathStart_pathClosed;}  // goto used for consistency with previous.
-
-			rhId_Prev = rhId_This ;
-			rhId_This = rhId_Next ;
-		}  // while(true)
-
-know_rhIdPathStart_pathClosed:
-
-
-		pathThisP->rhId_PathCentreClosest = rhId_PathStart_Better;
-		pathThisP->pathVeryClosed = pathThisP->pathClosed;
-
-		// Starting at rhPathBegin, re-follow path, counting length, and populating rhombus field withinPathNum.
-		pathThisP->pathLength = 1;
-
-		rhId_Prev = -1;
-		rhId_This = pathThisP->rhId_PathCentreClosest;
-		rhThisP = &(tlngP->rhombi[ rhId_This ]) ;
+		pathThisP->rhId_PathCentreFurthest = -1;  // Closed only
+		pathThisP->rhId_openPathEnd = -1;         // Open only
+		pathThisP->pathRhIds_Offset = numFatsListed;
+		pathRhIds = tlngP->pathRhIds + numFatsListed;
+
+		// First pass. Trace the path from rhId_PathStart, listing it in pathRhIds[], until either back at the start, so closed, or at a
+		// dead end. If a dead end, so open, resume from rhId_PathStart in the other direction to the other dead end; the part traced first
+		// is then reversed, so that the list runs from one end to the other.
+		rhThisP = &(tlngP->rhombi[ rhId_PathStart ]) ;
+		pathThisP->xMax = rhombus_hotBBox(tlngP, rhId_PathStart, xMax);  // This start value because -DBL_MAX is ugly.
+		pathThisP->yMax = rhombus_hotBBox(tlngP, rhId_PathStart, yMax);
+		pathThisP->xMin = rhombus_hotBBox(tlngP, rhId_PathStart, xMin);
+		pathThisP->yMin = rhombus_hotBBox(tlngP, rhId_PathStart, yMin);
+		pathThisP->pathLength = 0;
+		pathThisP->pathClosed = false;
+		numTracedFirst = -1;
 		thisPathSumX = 0;
 		thisPathSumY = 0;
-		pathThisP->xMax = rhThisP->xMax;  // This start value because -DBL_MAX is ugly.
-		pathThisP->yMax = rhThisP->yMax;
-		pathThisP->xMin = rhThisP->xMin;
-		pathThisP->yMin = rhThisP->yMin;
-		pathThisP->pathVeryClosed = pathThisP->pathClosed;
-		pathThisP->rhId_openPathEnd = -1;
+		twiceArea = 0;
+		allFourNeighbours = true;
+		rhId_Prev = -1;
+		rhId_This = rhId_PathStart;
 		while(true)
 		{
 			rhThisP = &(tlngP->rhombi[ rhId_This ]) ;
 			rhThisP->pathId = pathThisP->pathId ;
-			rhThisP->withinPathNum = pathThisP->pathLength - 1;  // Because this done here, can't in this loop use NextInPath_RhId()
-
-			thisPathSumX += rhThisP->centre.x ;
-			thisPathSumY += rhThisP->centre.y ;
-			if(pathThisP->xMax < rhThisP->xMax)  pathThisP->xMax = rhThisP->xMax;
-			if(pathThisP->yMax < rhThisP->yMax)  pathThisP->yMax = rhThisP->yMax;
-			if(pathThisP->xMin > rhThisP->xMin)  pathThisP->xMin = rhThisP->xMin;
-			if(pathThisP->yMin > rhThisP->yMin)  pathThisP->yMin = rhThisP->yMin;
-
-			if( pathThisP->pathVeryClosed  &&  pathThisP->pathClosedTypeNum % 2 == 0 )
+			pathRhIds[ (pathThisP->pathLength) ++ ] = rhId_This;
+
+			thisPathSumX += rhombus_hotCentre(tlngP, rhId_This).x ;  // Used only if closed, being in path order only then
+			thisPathSumY += rhombus_hotCentre(tlngP, rhId_This).y ;
+			if( rhId_Prev >= 0 )
+				twiceArea += centrePrev.x * rhombus_hotCentre(tlngP, rhId_This).y  -  rhombus_hotCentre(tlngP, rhId_This).x * centrePrev.y ;  // Shoelace, the sign of which is the direction of a closed path
+			centrePrev = rhombus_hotCentre(tlngP, rhId_This);
+			if(pathThisP->xMax < rhombus_hotBBox(tlngP, rhId_This, xMax))  pathThisP->xMax = rhombus_hotBBox(tlngP, rhId_This, xMax);
+			if(pathThisP->yMax < rhombus_hotBBox(tlngP, rhId_This, yMax))  pathThisP->yMax = rhombus_hotBBox(tlngP, rhId_This, yMax);
+			if(pathThisP->xMin > rhombus_hotBBox(tlngP, rhId_This, xMin))  pathThisP->xMin = rhombus_hotBBox(tlngP, rhId_This, xMin);
+			if(pathThisP->yMin > rhombus_hotBBox(tlngP, rhId_This, yMin))  pathThisP->yMin = rhombus_hotBBox(tlngP, rhId_This, yMin);
+
+			if( allFourNeighbours )
 			{
 				if( rhThisP->numNeighbours < 4 )
-					pathThisP->pathVeryClosed = false;
+					allFourNeighbours = false;
 				else
 				{
 					for( nghbrNum = 0  ;  nghbrNum < 4  ;  nghbrNum++ )  // rhThisP->numNeighbours must be 4
 						if( tlngP->rhombi[ rhThisP->neighbours[nghbrNum].rhId ].numNeighbours < 4 )
-							{pathThisP->pathVeryClosed = false;  break;}
+							{allFourNeighbours = false;  break;}
 				}  // rhThisP->numNeighbours == 4
-			}  // pathVeryClosed
+			}  // allFourNeighbours
 
-			noNewNeighbours = true ;
-			for( nghbrNum = 0  ;  nghbrNum < rhThisP->numNeighbours  ;  nghbrNum++ )
+			rhId_Next = fatNeighbour_other(tlngP,  rhThisP,  rhId_Prev);
+			if( rhId_Next == rhId_PathStart )
 			{
-				rhId_Next = rhThisP->neighbours[nghbrNum].rhId ;
-				if( Fat == rhThisP->neighbours[nghbrNum].physique  &&  rhId_Next != rhId_Prev )
-				{
-					if(rhId_Next == rhId_PathStart_Better)
-						goto know_pathLength;  // goto used as a multi-loop break.
-					else
-					{
-						noNewNeighbours = false;
-						(pathThisP->pathLength) ++;
-						break;
-					}
-				}  // Fat, etc
-			}  // for nghbrNum
-			pathThisP->rhId_openPathEnd = rhId_This;
-			if( noNewNeighbours )
-				goto know_pathLength;  // goto used for consistency with previous.
+				pathThisP->pathClosed = true;
+				twiceArea += centrePrev.x * rhombus_hotCentre(tlngP, rhId_PathStart).y  -  rhombus_hotCentre(tlngP, rhId_PathStart).x * centrePrev.y ;
+				break;
+			}  // Back at start, so closed
+			if( rhId_Next < 0  &&  numTracedFirst < 0 )
+			{
+				numTracedFirst = pathThisP->pathLength;
+				rhId_Prev = ( numTracedFirst > 1  ?  pathRhIds[1]  :  -1 );
+				rhId_This = rhId_PathStart;
+				rhId_Next = fatNeighbour_other(tlngP,  &(tlngP->rhombi[ rhId_PathStart ]),  rhId_Prev);
+			}  // First dead end, so open
+			if( rhId_Next < 0 )
+				break;  // Open, and both ends found
 
 			rhId_Prev = rhId_This ;
 			rhId_This = rhId_Next ;
 		}  // while(true)
 
-know_pathLength:
-
-		if( pathThisP->pathVeryClosed )
-			tlngP->anyPathsVeryClosed = true;
-
-		pathThisP->centre.x = thisPathSumX / pathThisP->pathLength ;
-		pathThisP->centre.y = thisPathSumY / pathThisP->pathLength ;
+		numFatsListed += pathThisP->pathLength;
 
 		if( pathThisP->pathClosed )
 		{
-			// Starting at rhId_PathStart_Better, re-follow path, and calculating which closest to centre
-			rhId_This = rhId_PathStart_Better;
-			pathRhPathRhombNumClosest = tlngP->rhombi[ rhId_This ].withinPathNum;
-			pathThisP->rhId_PathCentreClosest  = rhId_This;
-			pathThisP->rhId_PathCentreFurthest = rhId_This;
-			dist2Closest = rhWithinPathMoreSpecial(
-				true,  // Want closest corner
-				pathThisP,
-				&(tlngP->rhombi[ rhId_This ]),
-				&(tlngP->rhombi[ rhId_This ]),
-				0,  // Irrelevant
-				distance2Epsilon, distanceEpsilon  // Irrelevant
-			);
-			dist2Furthest = rhWithinPathMoreSpecial(
-				false,  // Want furthest corner
-				pathThisP,
-				&(tlngP->rhombi[ rhId_This ]),
-				&(tlngP->rhombi[ rhId_This ]),
-				0,  // Irrelevant
-				distance2Epsilon, distanceEpsilon  // Irrelevant
-			);
-
-			while(true)
+			pathThisP->centre.x = thisPathSumX / pathThisP->pathLength ;
+			pathThisP->centre.y = thisPathSumY / pathThisP->pathLength ;
+
+			// Which rhombi closest to and furthest from the centre, from only the centres in the hot arrays.
+			rhPathNumClosest = 0;
+			pathThisP->rhId_PathCentreClosest  = pathRhIds[0];
+			pathThisP->rhId_PathCentreFurthest = pathRhIds[0];
+			dist2Closest = dist2Furthest = distance2(rhombus_hotCentre(tlngP, pathRhIds[0]),  pathThisP->centre);
+			for( rhPathNum = 1  ;  rhPathNum < pathThisP->pathLength  ;  rhPathNum++ )
 			{
-				rhThisP  =  &(tlngP->rhombi[ rhId_This ]) ;
-				rhId_Next = NextInPath_RhId(tlngP->rhombi, rhThisP, pathThisP->pathLength, true);
+				rhId_This = pathRhIds[rhPathNum];
 
 				dist2Temp = rhWithinPathMoreSpecial(
 					true,  // Want closest
-					pathThisP,
-					&(tlngP->rhombi[ rhId_This ]),
-					&(tlngP->rhombi[ pathThisP->rhId_PathCentreClosest ]),
+					pathThisP->centre,
+					rhombus_hotCentre(tlngP, rhId_This),
+					rhombus_hotCentre(tlngP, pathThisP->rhId_PathCentreClosest),
 					dist2Closest,
 					distance2Epsilon, distanceEpsilon
 				);
 				if( dist2Temp >= 0 )
 				{
-					pathRhPathRhombNumClosest = rhThisP->withinPathNum ;
+					rhPathNumClosest = rhPathNum ;
 					pathThisP->rhId_PathCentreClosest = rhId_This ;
 					dist2Closest = dist2Temp;
 				}  // dist2Temp > 0
 
 				dist2Temp = rhWithinPathMoreSpecial(
 					false,  // Want furthest
-					pathThisP,
-					&(tlngP->rhombi[ rhId_This ]),
-					&(tlngP->rhombi[ pathThisP->rhId_PathCentreFurthest ]),
+					pathThisP->centre,
+					rhombus_hotCentre(tlngP, rhId_This),
+					rhombus_hotCentre(tlngP, pathThisP->rhId_PathCentreFurthest),
 					dist2Furthest,
 					distance2Epsilon, distanceEpsilon
 				);
@@ -320,120 +303,114 @@ know_pathLength:
 					pathThisP->rhId_PathCentreFurthest = rhId_This ;
 					dist2Furthest = dist2Temp;
 				}  // dist2Temp > 0
-
-				if( rhId_Next < 0 )
-					break;  // Open path, impossible here
-				if( tlngP->rhombi[rhId_Next].withinPathNum == 0 )
-					break;  // Closed path, back to start
-
-				rhId_This = rhId_Next ;
-			}  // while(true)
+			}  // for( rhPathNum ... )
 
 			pathThisP->radiusMin = sqrt(dist2Closest);
 			pathThisP->radiusMax = sqrt(dist2Furthest);
 
-			// Starting at rhPathBegin, reset pathRhombNum such that the closest to the centre is 0
-			isClockwise = ( point_winding_number(
-				pathThisP->centre.x + tlngP->edgeLength / 64,
-				pathThisP->centre.y + tlngP->edgeLength / 64,
-				pathThisP,
-				tlngP
-			) > 0 );
-
-			// Known: centre, rhId_PathStart, isClockwise
-
-			// Rotate such that pathRhPathRhombNumClosest has pathRhombNum of 0.
-			// And, such that path goes clockwise, if necessary reflect.
-			long int * const pathListed = malloc( pathThisP->pathLength * sizeof(rhId_This) );
-			if( pathListed != NULL )
+			// Rotate such that the closest to the centre is first. And, such that path goes clockwise, if necessary reflect.
+			// With y up, as here, a clockwise polygon has negative area. All in place, by reversals.
+			isClockwise = ( twiceArea < 0 );
+			if( isClockwise )
 			{
-				pathListed[0] = pathThisP->rhId_PathCentreClosest;
-				for( rhPathNum = 1  ;  rhPathNum < pathThisP->pathLength ;  rhPathNum++ )
-					pathListed[rhPathNum] = NextInPath_RhId(tlngP->rhombi, tlngP->rhombi + pathListed[rhPathNum - 1], pathThisP->pathLength, true);
-
-				for( rhPathNum = 0  ;  rhPathNum < pathThisP->pathLength ;  rhPathNum++ )
-				{
-					tlngP->rhombi[pathListed[rhPathNum]].withinPathNum = ( pathThisP->pathLength
-						+ (tlngP->rhombi[pathListed[rhPathNum]].withinPathNum - pathRhPathRhombNumClosest) * (isClockwise ? +1 : -1)
-					) % pathThisP->pathLength;
-				}  // for( rhPathNum ... )
-				free(pathListed);
-			}  // if( pathListed != NULL )
-
-			rhId_This = pathThisP->rhId_PathCentreClosest;
-			while(true)
+				pathRhIds_reverse(pathRhIds,  0,  rhPathNumClosest - 1);
+				pathRhIds_reverse(pathRhIds,  rhPathNumClosest,  pathThisP->pathLength - 1);
+				pathRhIds_reverse(pathRhIds,  0,  pathThisP->pathLength - 1);
+			}  // isClockwise
+			else
 			{
-				rhThisP  =  &(tlngP->rhombi[ rhId_This ]) ;
-				rhId_Next = NextInPath_RhId(tlngP->rhombi, rhThisP, pathThisP->pathLength, true);
-
-				rhThisP->closerPathCentreN = (
-					( pow(pathThisP->centre.x  -  rhThisP->north.x, 2)  +  pow(pathThisP->centre.y  -  rhThisP->north.y, 2) ) <
-					( pow(pathThisP->centre.x  -  rhThisP->south.x, 2)  +  pow(pathThisP->centre.y  -  rhThisP->south.y, 2) )
-				);  // closerPathCentreN
-				rhThisP->closerPathCentreE = (
-					( pow(pathThisP->centre.x  -  rhThisP->east.x , 2)  +  pow(pathThisP->centre.y  -  rhThisP->east.y , 2) ) <
-					( pow(pathThisP->centre.x  -  rhThisP->west.x , 2)  +  pow(pathThisP->centre.y  -  rhThisP->west.y , 2) )
-				);  // closerPathCentreE
-
-				if( rhId_Next < 0 )
-					break;  // Open path, impossible here
-				if( tlngP->rhombi[rhId_Next].withinPathNum == 0 )
-					break;  // Closed path, back to start
-
-				rhId_This = rhId_Next ;
-			}  // while(true)
+				pathRhIds_reverse(pathRhIds,  0,  rhPathNumClosest);
+				pathRhIds_reverse(pathRhIds,  rhPathNumClosest + 1,  pathThisP->pathLength - 1);
+			}  // ! isClockwise
+		}  // if pathClosed
+		else
+		{
+			pathRhIds_reverse(pathRhIds,  0,  numTracedFirst - 1);
+			pathThisP->rhId_PathCentreClosest = pathRhIds[0];  // For open, the path's start
+			pathThisP->rhId_openPathEnd = pathRhIds[ pathThisP->pathLength - 1 ];
+			thisPathSumX = 0;  // Re-summed in the second pass, in path order
+			thisPathSumY = 0;
+		}  // ! pathClosed
+
+		// Second pass, with the list now in path order: number the fats, and link each to those either side of it.
+		for( rhPathNum = 0  ;  rhPathNum < pathThisP->pathLength  ;  rhPathNum++ )
+		{
+			rhThisP  =  &(tlngP->rhombi[ pathRhIds[rhPathNum] ]) ;
+			rhThisP->withinPathNum = rhPathNum;
+			if( rhPathNum > 0 )
+				rhThisP->rhId_PathPrev = pathRhIds[ rhPathNum - 1 ];
+			else
+				rhThisP->rhId_PathPrev = ( pathThisP->pathClosed  ?  pathRhIds[ pathThisP->pathLength - 1 ]  :  -1 );
+			if( rhPathNum + 1 < pathThisP->pathLength )
+				rhThisP->rhId_PathNext = pathRhIds[ rhPathNum + 1 ];
+			else
+				rhThisP->rhId_PathNext = ( pathThisP->pathClosed  ?  pathRhIds[0]  :  -1 );
+
+			if( pathThisP->pathClosed )
+			{
+				rhThisP->closerPathCentreN = ( distance2(pathThisP->centre, rhombus_north(tlngP, rhThisP))  <  distance2(pathThisP->centre, rhombus_south(tlngP, rhThisP)) );
+				rhThisP->closerPathCentreE = ( distance2(pathThisP->centre, rhombus_east(tlngP, rhThisP) )  <  distance2(pathThisP->centre, rhombus_west(tlngP, rhThisP) ) );
+			}  // pathClosed
+			else
+			{
+				thisPathSumX += rhombus_hotCentre(tlngP, pathRhIds[rhPathNum]).x ;
+				thisPathSumY += rhombus_hotCentre(tlngP, pathRhIds[rhPathNum]).y ;
+			}  // ! pathClosed
+		}  // for( rhPathNum ... )
 
+		if( pathThisP->pathClosed )
+		{
 			// set orientationDegrees
 			do  // break'able construct
 			{
 				rhThisP = &(tlngP->rhombi[ pathThisP->rhId_PathCentreClosest ]);
 				orientationFound = false;
 
-				if( collinear(rhThisP->north,  rhThisP->south,  pathThisP->centre,  tlngP) )
+				if( collinear(rhombus_north(tlngP, rhThisP),  rhombus_south(tlngP, rhThisP),  pathThisP->centre,  tlngP) )
 				{
 					pathThisP->orientationDegrees = atan2(
-						rhThisP->north.y - rhThisP->south.y,
-						rhThisP->north.x - rhThisP->south.x
+						rhombus_north(tlngP, rhThisP).y - rhombus_south(tlngP, rhThisP).y,
+						rhombus_north(tlngP, rhThisP).x - rhombus_south(tlngP, rhThisP).x
 					) * DegreesPerRadian ;
 					orientationFound = true;
 					break;
 				}  // north-south
 
-				if( collinear(rhThisP->north,  rhThisP->east,  pathThisP->centre,  tlngP) )
+				if( collinear(rhombus_north(tlngP, rhThisP),  rhombus_east(tlngP, rhThisP),  pathThisP->centre,  tlngP) )
 				{
 					pathThisP->orientationDegrees = atan2(
-						rhThisP->north.y - rhThisP->east.y,
-						rhThisP->north.x - rhThisP->east.x
+						rhombus_north(tlngP, rhThisP).y - rhombus_east(tlngP, rhThisP).y,
+						rhombus_north(tlngP, rhThisP).x - rhombus_east(tlngP, rhThisP).x
 					) * DegreesPerRadian ;
 					orientationFound = true;
 					break;
 				}  // north-east
 
-				if( collinear(rhThisP->north,  rhThisP->west,  pathThisP->centre,  tlngP) )
+				if( collinear(rhombus_north(tlngP, rhThisP),  rhombus_west(tlngP, rhThisP),  pathThisP->centre,  tlngP) )
 				{
 					pathThisP->orientationDegrees = atan2(
-						rhThisP->north.y - rhThisP->west.y,
-						rhThisP->north.x - rhThisP->west.x
+						rhombus_north(tlngP, rhThisP).y - rhombus_west(tlngP, rhThisP).y,
+						rhombus_north(tlngP, rhThisP).x - rhombus_west(tlngP, rhThisP).x
 					) * DegreesPerRadian ;
 					orientationFound = true;
 					break;
 				}  // north-west
 
-				if( collinear(rhThisP->south,  rhThisP->east,  pathThisP->centre,  tlngP) )
+				if( collinear(rhombus_south(tlngP, rhThisP),  rhombus_east(tlngP, rhThisP),  pathThisP->centre,  tlngP) )
 				{
 					pathThisP->orientationDegrees = atan2(
-						rhThisP->south.y - rhThisP->east.y,
-						rhThisP->south.x - rhThisP->east.x
+						rhombus_south(tlngP, rhThisP).y - rhombus_east(tlngP, rhThisP).y,
+						rhombus_south(tlngP, rhThisP).x - rhombus_east(tlngP, rhThisP).x
 					) * DegreesPerRadian ;
 					orientationFound = true;
 					break;
 				}  // south-east
 
-				if( collinear(rhThisP->south,  rhThisP->west,  pathThisP->centre,  tlngP) )
+				if( collinear(rhombus_south(tlngP, rhThisP),  rhombus_west(tlngP, rhThisP),  pathThisP->centre,  tlngP) )
 				{
 					pathThisP->orientationDegrees = atan2(
-						rhThisP->south.y - rhThisP->west.y,
-						rhThisP->south.x - rhThisP->west.x
+						rhombus_south(tlngP, rhThisP).y - rhombus_west(tlngP, rhThisP).y,
+						rhombus_south(tlngP, rhThisP).x - rhombus_west(tlngP, rhThisP).x
 					) * DegreesPerRadian ;
 					orientationFound = true;
 					break;
@@ -450,22 +427,30 @@ know_pathLength:
 			}  // if( orientationFound )
 
 		}  // if pathClosed
+		else
+		{
+			pathThisP->centre.x = thisPathSumX / pathThisP->pathLength ;
+			pathThisP->centre.y = thisPathSumY / pathThisP->pathLength ;
+		}  // ! pathClosed
+
+		rhThisP = &(tlngP->rhombi[ pathThisP->rhId_PathCentreClosest ]);
+		pathThisP->pointy = ( 5 == pathThisP->pathLength  &&  pathThisP->pathClosed  &&  points_same_2(tlngP, rhombus_north(tlngP, rhThisP), pathThisP->centre) ) ;
+		pathThisP->pathClosedTypeNum = pathClosedTypeNum(pathThisP->pathClosed,  pathThisP->pathLength,  pathThisP->pointy);
+
+		// Decided only now, pathClosedTypeNum being known. Four-neighbour surroundings are required only of even pathClosedTypeNum.
+		pathThisP->pathVeryClosed = ( pathThisP->pathClosed  &&  ( allFourNeighbours  ||  pathThisP->pathClosedTypeNum % 2 != 0 ) );
+		if( pathThisP->pathVeryClosed )
+			tlngP->anyPathsVeryClosed = true;
 
 		if( pathThisP->pathClosed )
 			(tlngP->numPathsClosed) ++ ;
 		else
 			(tlngP->numPathsOpen) ++ ;
 
-	}  // for( rhId_PathStart ... )
+	}  // for( k ... )
 
-	for( pathId = 0  ;  pathId < tlngP->numPathsClosed + tlngP->numPathsOpen  ;  pathId ++ )
-	{
-		pathThisP = &(tlngP->path[ pathId ]);
-		rhThisP = &(tlngP->rhombi[ pathThisP->rhId_PathCentreClosest ]);
-		pathThisP->pointy = ( 5 == pathThisP->pathLength  &&  pathThisP->pathClosed  &&  points_same_2(tlngP, rhThisP->north, pathThisP->centre) ) ;
-
-		pathThisP->pathClosedTypeNum = pathClosedTypeNum(pathThisP->pathClosed,  pathThisP->pathLength,  pathThisP->pointy);
-	}  // rhId_This
+	if( NULL != orderByYP )
+		rhombiOrder_free(orderByYP);
 
 	paths_sort(tlngP, &pathGt_ByClosedEtc);
 
@@ -2,6 +2,12 @@
 // Released under GNU General Public License, Version 3, https://www.gnu.org/licenses/gpl-3.0.txt
 // penrose.h, in PenroseC
 
+// Before any system header, so that a strict -std=c99 build also declares the POSIX functions used: by bigArrays.c,
+// ftruncate(), mmap(), and posix_madvise(); and elsewhere, pthreads.
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include <inttypes.h>
 #include <time.h>
 #include <math.h>
@@ -11,9 +17,42 @@
 #include <limits.h>
 #include <float.h>
 #include <string.h>
+#include <pthread.h>
 
 #define scratchStringLength 32767
 
+// If true, every vertex also held exactly as integer coordinates (see lattice.c), with doubles derived from those.
+// Then duplicate-purging and vertex-matching are exact, rather than within an epsilon. Costs 72 bytes per rhombus.
+#define ExactCoordinates false
+
+// If true, rhombi's centres and bounding boxes are held not in each Rhombus but in separate arrays of the tiling (see hotArrays.c), for
+// faster scanning by loops that read only those, and so that sorts and purges move smaller records.
+#define HotArrays true
+
+// If true, a neighbour's rhId, and a fat's links to next and prev in its path, are held in 4 bytes rather than 8, so saving 40 bytes per
+// rhombus, but limiting a tiling to 2^31 - 1 rhombi.
+#define CompactNeighbours true
+
+// If true, a Rhombus holds only its exact north, its direction, and its links, being 60 bytes rather than the 232 of ExactCoordinates
+// and CompactNeighbours (280 if HotArrays false). Its south, east, west, centre, bounding box, and angleDegrees are derived when read,
+// by rhombus_south() etc., and its small fields and those of its neighbours are bit-packed. Slower, but with HotArrays false and edge
+// ownership, tilingId 18 (about 0.37 billion rhombi) should need about 53 GiB, so fit in 64 GiB: see text/c.md. Needs ExactCoordinates
+// and CompactNeighbours, and limits a tiling to 2^29 - 1 rhombi.
+#define CompactRhombi false
+#if CompactRhombi  &&  ! (ExactCoordinates  &&  CompactNeighbours)
+#error "CompactRhombi needs ExactCoordinates and CompactNeighbours."
+#endif
+
+// If true, a tiling's rhombi[], hotCentres[], hotBBoxes[], path[], pathRhIds[], and pathStat[] can be placed in memory-mapped files, as
+// chosen by arraysMappedQ() (see bigArrays.c), so that very deep recursions can trade RAM for disk. Needs POSIX.1-2008 mmap(), ftruncate(),
+// and posix_madvise(); if unavailable, set to false.
+#define MappedArrays true
+#if MappedArrays
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 // Useful constants, to 28dp. Comparison: Sun-Jupiter distance ~= 10^27 proton widths.
 static double const DegreesPerRadian          = 57.2957795130823208767981548141;   // 180/Pi
 static double const GoldenRatioSquare         =  2.6180339887498948482045868344;   // (sqrt(5) + 3) / 2
@@ -63,53 +102,104 @@ typedef enum  // Physique
 
 typedef struct {double x;  double y;} XY;
 
+typedef struct {double xMin;  double xMax;  double yMin;  double yMax;} BBox;
+
+typedef struct {int32_t a[4];} Lattice;  // Coefficients of e[0..3], as in lattice.c.
+
 typedef  long  int  RhombId   ;
+#define RhombId_NumMax  (CompactRhombi ? (1L << 29) - 1 : CompactNeighbours ? (long int)INT32_MAX : LONG_MAX)  // Most rhombi in a tiling, as a Neighbour's rhId must hold any rhId.
 typedef  long  int  PathId    ;
 typedef  long  int  PathStatId;
 typedef  int8_t     TilingId  ;
 
 typedef struct  // Neighbour
 {
-	RhombId   rhId;
-	Physique  physique;
-	bool      touchesN;
-	bool      touchesE;
-	int8_t    nghbrsNghbrNum;  // Neighbour's Neighbour Num, Abbreviated to NNN in output: I am the neighbour[NNN] of my neighbour. Fussy to use int8_t, but saves 4 bytes per rhombus, > 1%.
-	PathId    pathId;
-	long int  withinPathNum ;  // Counting within a path: 0, 1, ..., pathLength - 1.
+#if CompactRhombi  // 4 bytes. Physique is that of rhombi[rhId], and nghbrsNghbrNum is in the Rhombus: read both by neighbour_physique() etc.
+	signed int    rhId           : 30;
+	unsigned int  touchesN       : 1;
+	unsigned int  touchesE       : 1;
+#else
+#if CompactNeighbours
+	int32_t       rhId;
+#else
+	RhombId       rhId;
+#endif
+	unsigned int  physique       : 8;
+	unsigned int  touchesN       : 1;
+	unsigned int  touchesE       : 1;
+	signed int    nghbrsNghbrNum : 3;  // Neighbour's Neighbour Num, Abbreviated to NNN in output: I am the neighbour[NNN] of my neighbour. -1 to 3, so 3 bits.
+#endif
+	// Neighbour's pathId and withinPathNum are those of rhombi[rhId], so not duplicated here.
 } Neighbour;
 
 
+// With the default #defines, sizeof(Rhombus) is 160 bytes, plus 48 per rhombus in the hot arrays. If CompactRhombi, 60 bytes.
+// Vertices, centre, bounding box, and angleDegrees should be read with rhombus_north(), rhombus_centre(), etc., defined below.
 typedef struct  // Rhombus
 {
+#if CompactRhombi
+	int32_t       rhId;
+	unsigned int  physique          : 7;  // Thin or Fat, being 36 or 72.
+	unsigned int  filledType        : 3;
+	unsigned int  numNeighbours     : 3;
+	unsigned int  closerPathCentreN : 1;
+	unsigned int  closerPathCentreE : 1;
+	unsigned int  wantedPostScript  : 1;
+	unsigned int  directionExact    : 4;
+	unsigned int  nghbrsNghbrNums   : 12;  // For each of neighbours[], 3 bits holding its nghbrsNghbrNum + 1, read by neighbour_nghbrsNghbrNum().
+	Lattice       northExact;  // The only vertex held. South, east and west are derived from this, directionExact, and physique.
+#else
 	RhombId    rhId;
 
 	Physique   physique;
 	int8_t     filledType;
+	int8_t     numNeighbours;  // Here, with the other small fields, to save padding.
+	bool       closerPathCentreN;
+	bool       closerPathCentreE;
+	bool       wantedPostScript;  // <==> any of its are fats
+
 	XY         north;  // Orientation local to rhombus.  because meaningful points, these are XY struct.
 	XY         south;
 	XY         east;
 	XY         west;
+#if ! HotArrays  // Else in the tiling's hotCentres[] and hotBBoxes[]. Either way, read by rhombus_centre() etc.
 	XY         centre;
 
 	double     xMin;  // (xMin,yMin) is not a meaningful point, so separate scalars.
 	double     xMax;
 	double     yMin;
 	double     yMax;
+#endif
 
 	double     angleDegrees;
 
-	int8_t     numNeighbours;
+#if ExactCoordinates
+	Lattice    northExact;
+	Lattice    southExact;
+	Lattice    eastExact;
+	Lattice    westExact;
+	int8_t     directionExact;  // Direction from north to south is lattice_unit(directionExact - h) + lattice_unit(directionExact + h), h as rhombus_append_exact().
+#endif
+#endif  // CompactRhombi
+
 	Neighbour  neighbours[4];
 
+#if CompactRhombi
+	int32_t    pathId;
+	int32_t    withinPathNum;
+	int32_t    pathId_ShortestOuter;  // Thins only, as Fats done at level of Path.
+#else
 	PathId     pathId;
 	long int   withinPathNum;
 	PathId     pathId_ShortestOuter;  // Thins only, as Fats done at level of Path.
-
-	bool       closerPathCentreN;
-	bool       closerPathCentreE;
-
-	bool       wantedPostScript;  // <==> any of its are fats
+#endif
+#if CompactNeighbours
+	int32_t    rhId_PathNext;  // Fats only, set by paths_populate(): rhombus with withinPathNum one more (cyclically if closed). -1 at end of open path.
+	int32_t    rhId_PathPrev;  // Fats only: likewise one less. -1 at start of open path.
+#else
+	RhombId    rhId_PathNext;
+	RhombId    rhId_PathPrev;
+#endif
 } Rhombus;
 
 
@@ -117,7 +207,7 @@ typedef struct  // Path
 {
 	PathId      pathId;
 	bool        pathClosed;
-	bool        pathVeryClosed;  // All neighbouring tiles have four neightbours. I.e., far from outside of whole tiling.
+	bool        pathVeryClosed;  // Closed, and either pathClosedTypeNum odd or all neighbouring tiles have four neighbours. I.e., far from outside of whole tiling.
 	long int    pathLength;
 	bool        pointy;  // If pathClosed && 5==pathLength then: true ==> ten neighbouring thins in a pointy star; false ==> five neighbouring thins lying flat to it.
 	int8_t      pathClosedTypeNum;  // -1=open; 1=5r, 2=5p, 3=15, 4=25, 5=55, ...
@@ -125,10 +215,11 @@ typedef struct  // Path
 	PathStatId  pathStatId;
 
 	RhombId     rhId_PathCentreClosest;   // Rhombus with corner closest to path's centre, so used as path's starting rhombus with withinPathNum == 0
-	RhombId     rhId_PathCentreFurthest;  // Rhombus with corner furthest from path's centre.
+	RhombId     rhId_PathCentreFurthest;  // Rhombus with corner furthest from path's centre.  -1 if open.
 	RhombId     rhId_openPathEnd;
 	RhombId     rhId_ThinWithin_First;
 	RhombId     rhId_ThinWithin_Last;
+	RhombId     pathRhIds_Offset;  // This path's fats, in path order, are tiling's pathRhIds[pathRhIds_Offset + withinPathNum].
 
 	XY          centre;  // This an XY struct because this a meaningful point; not true of extremal corners.
 	double      xMin;
@@ -150,6 +241,23 @@ typedef struct  // Path
 } Path;
 
 
+typedef struct  // SpatialHashSlot
+{
+	int64_t    cellX;
+	int64_t    cellY;
+	long int   value;  // <0 ==> empty
+} SpatialHashSlot;
+
+
+typedef struct  // SpatialHash, as in spatialHash.c
+{
+	double            pitch;     // Side of square cells.
+	long int          numSlots;  // Power of 2.
+	long int          numUsed;
+	SpatialHashSlot * slots;
+} SpatialHash;
+
+
 typedef struct  // PathStats
 {
 	PathStatId pathStatId;
@@ -189,19 +297,44 @@ typedef struct  // Tiling
 	long int   numThins;
 	long int   rhombi_NumMax;
 	Rhombus    * rhombi;
+	bool       rhombi_Mapped;  // As bigArrays.c, as are path_Mapped, pathRhIds_Mapped, and pathStat_Mapped.
+	bool       rhombi_Spatial;  // Sorted by rhombi_sortSpatially(), rather than by rhombi_sort().
+	bool       rhombi_Scratch;  // A buffer of descendants_append_parallel(): rhombi[] never mapped, and neither hot arrays nor bounding box kept.
+	bool       arrays_Private;  // A thread's copy of part of a tiling, as made by holesFill(): arrays never mapped, but otherwise as any tiling.
 	double     xMax;
 	double     xMin;
 	double     yMax;
 	double     yMin;
 
+	long int   roi_numVertices;      // Region of interest, as regionOfInterest.c: from roi_polygon(). Zero ==> none.
+	XY const * roi_vertices;
+	double     roi_marginDistance;   // From roi_margin().
+
+#if HotArrays
+	long int   hot_NumMax;
+	XY         * hotCentres;  // Indexed by rhId, the rhombi's centres, as hotArrays.c.
+	BBox       * hotBBoxes;   // Likewise their bounding boxes.
+	bool       hotCentres_Mapped;  // As bigArrays.c.
+	bool       hotBBoxes_Mapped;
+#endif
+
+#if ExactCoordinates
+	XY         latticeOrigin;    // Location of Lattice (0,0,0,0).
+	XY         latticeBasis[4];  // e[0..3] of lattice.c, for this tilingId's edgeLength.
+#endif
+
 	long int   path_NumMax;
 	Path       * path;
+	bool       path_Mapped;
+	RhombId    * pathRhIds;  // numFats long: each path's fats, in path order, contiguously from path[].pathRhIds_Offset.
+	bool       pathRhIds_Mapped;
 	long int   numPathsClosed;
 	long int   numPathsOpen;
 	bool       anyPathsVeryClosed;
 
 	long int   pathStats_NumMax;
 	PathStats  * pathStat;
+	bool       pathStat_Mapped;
 	long int   numPathStats;
 
 	char       const * filePath;
@@ -213,6 +346,52 @@ typedef struct  // Tiling
 } Tiling;
 
 
+// A read-only view of a tiling's rhombi in some order, without moving them, as made by rhombiOrder_make().
+// NULL means the tiling's own order. Exporters iterate rhombiOrder_rhId(orderP, k) for k = 0, 1, ...
+typedef struct
+{
+	long int   numRhombi;
+	RhombId  * rhIds;               // rhIds[k] is the k-th rhombus in this order.
+	RhombId  * thinWithin_First;    // Indexed by pathId: as Path.rhId_ThinWithin_First and _Last, but positions k in this order.
+	RhombId  * thinWithin_Last;
+} RhombiOrder;
+
+
+typedef struct  // Located: as found by locate_point(), in locate.c.
+{
+	Rhombus    rhombus;           // The rhombus containing the point. Its neighbours' rhIds index neighbourhood[], or are -1.
+	XY         north;             // Of rhombus, as are south, centre, and angleDegrees, because if CompactRhombi these are derived from its
+	XY         south;             // tiling, which is then gone. Likewise rootCentre.
+	XY         centre;
+	double     angleDegrees;
+	TilingId   tilingId;
+	TilingId   rootTilingId;      // The rhombus descends from root, in this tilingId: the seed's, or that in which holesFill() made root.
+	Rhombus    root;
+	XY         rootCentre;
+	RhombId    rootRhId;          // If rootTilingId is the seed's, root's rhId in the seed tiling; else -1.
+	int8_t   * address;           // For rootTilingId < t <= tilingId, address[t] is the childNum, in rhombus_append_descendants(), of the ancestor in t.
+	long int   numNeighbourhood;
+	Rhombus  * neighbourhood;     // Rhombi with centres within the neighbourhoodRadius, renumbered; or NULL.
+} Located;
+
+
+typedef struct  // PentagridFrame: a tilingId's pentagrid, as made by pentagrid_frame(), shared by all its windows.
+{
+	double     gamma[5];          // Offsets of the five families of lines, as in pentagrid.c.
+	XY         unit[5];           // u[j], in the grid's space.
+	XY         basis[5];          // e[j], in the tiling's coordinates.
+	XY         origin;            // The seed's north, the vertex with every K[j] zero.
+	double     angleRadians;      // Of e[0], from the seed's north to south.
+	double     edgeLength;
+	int8_t     gammasSum;
+} PentagridFrame;
+
+
+#define rhombiOrder_rhId(orderP, k)  ( NULL == (orderP)  ?  (k)  :  (orderP)->rhIds[k] )
+#define rhombiOrder_thinWithin_First(orderP, tlngP, pathId)  ( NULL == (orderP)  ?  (tlngP)->path[pathId].rhId_ThinWithin_First  :  (orderP)->thinWithin_First[pathId] )
+#define rhombiOrder_thinWithin_Last( orderP, tlngP, pathId)  ( NULL == (orderP)  ?  (tlngP)->path[pathId].rhId_ThinWithin_Last   :  (orderP)->thinWithin_Last[ pathId] )
+
+
 
 // Functions and sub-routines
 
@@ -220,6 +399,7 @@ extern inline double    min_2(double const d0, double const d1);
 extern inline double    max_2(double const d0, double const d1);
 extern        double    min_4(double const d0, double const d1, double const d2, double const d3);
 extern        double    max_4(double const d0, double const d1, double const d2, double const d3);
+extern        double    wallClockSeconds(void);
 extern        double    avg_2(double const d0, double const d1);
 extern        double median_3(double const d0, double const d1, double const d2);
 extern        double median_4(double const d0, double const d1, double const d2, double const d3);
@@ -230,6 +410,100 @@ extern bool points_same_2(Tiling const * const tlngP, XY const xy0, XY const xy1
 extern bool points_same_3(Tiling const * const tlngP, XY const xy0, XY const xy1, XY const xy2);
 extern bool points_same_4(Tiling const * const tlngP, XY const xy0, XY const xy1, XY const xy2, XY const xy3);
 
+#if ExactCoordinates
+bool    lattice_same(Lattice const p0,  Lattice const p1);
+Lattice lattice_add(Lattice const p0,  Lattice const p1);
+Lattice lattice_subtract(Lattice const p0,  Lattice const p1);
+Lattice lattice_timesGoldenRatio(Lattice const p);
+Lattice lattice_rotate(Lattice const p,  int8_t steps);
+Lattice lattice_unit(int8_t j);
+XY      lattice_xy(Tiling const * const tlngP,  Lattice const p);
+void    lattice_basis_initial(Tiling * const tlngP,  XY const origin,  double const angleRadians);
+void    lattice_basis_descendant(Tiling * const tlngDescendantP,  Tiling const * const tlngAncestorP);
+#endif
+
+// A rhombus's vertices and angleDegrees, read by rhombus_north(tlngP, rhP) etc., tlngP being the tiling of which rhP is one of the rhombi.
+// If CompactRhombi these are derived from northExact, directionExact and physique, as rhombus_append_exact() made them; else are fields.
+// Likewise a neighbour's physique, read by neighbour_physique(tlngP, nghbrP), and its nghbrsNghbrNum, by neighbour_nghbrsNghbrNum().
+#if ExactCoordinates
+#if CompactRhombi
+	#define rhombus_halfAngleSteps(rhP)  ( Fat == (rhP)->physique ? 1 : 2 )
+	#define rhombus_northExact(rhP)      ( (rhP)->northExact )
+	#define rhombus_eastExact(rhP)       lattice_add( (rhP)->northExact,  lattice_unit((rhP)->directionExact + rhombus_halfAngleSteps(rhP)) )
+	#define rhombus_westExact(rhP)       lattice_add( (rhP)->northExact,  lattice_unit((rhP)->directionExact - rhombus_halfAngleSteps(rhP)) )
+	#define rhombus_southExact(rhP)      lattice_add( rhombus_eastExact(rhP),  lattice_unit((rhP)->directionExact - rhombus_halfAngleSteps(rhP)) )
+	#define rhombus_north(tlngP, rhP)    lattice_xy( (tlngP),  rhombus_northExact(rhP) )
+	#define rhombus_south(tlngP, rhP)    lattice_xy( (tlngP),  rhombus_southExact(rhP) )
+	#define rhombus_east(tlngP, rhP)     lattice_xy( (tlngP),  rhombus_eastExact(rhP) )
+	#define rhombus_west(tlngP, rhP)     lattice_xy( (tlngP),  rhombus_westExact(rhP) )
+	#define rhombus_angleDegrees(tlngP, rhP)  rhombus_derivedAngleDegrees( rhombus_north((tlngP), (rhP)),  rhombus_south((tlngP), (rhP)) )
+	#define neighbour_physique(tlngP, nghbrP)  ( (Physique)(tlngP)->rhombi[(nghbrP)->rhId].physique )
+	#define neighbour_nghbrsNghbrNum(rhP, nghbrNum)  ( (int8_t)(((rhP)->nghbrsNghbrNums >> (3 * (nghbrNum))) & 7) - 1 )
+	#define neighbour_nghbrsNghbrNum_set(rhP, nghbrNum, nnn)  ( (rhP)->nghbrsNghbrNums = ((rhP)->nghbrsNghbrNums & ~(7u << (3 * (nghbrNum))))  |  ((unsigned int)((nnn) + 1) << (3 * (nghbrNum))) )
+#else
+	#define rhombus_northExact(rhP)      ( (rhP)->northExact )
+	#define rhombus_eastExact(rhP)       ( (rhP)->eastExact )
+	#define rhombus_westExact(rhP)       ( (rhP)->westExact )
+	#define rhombus_southExact(rhP)      ( (rhP)->southExact )
+#endif  // CompactRhombi
+#endif  // ExactCoordinates
+#if ! CompactRhombi
+	#define rhombus_north(tlngP, rhP)    ( (rhP)->north )
+	#define rhombus_south(tlngP, rhP)    ( (rhP)->south )
+	#define rhombus_east(tlngP, rhP)     ( (rhP)->east )
+	#define rhombus_west(tlngP, rhP)     ( (rhP)->west )
+	#define rhombus_angleDegrees(tlngP, rhP)  ( (rhP)->angleDegrees )
+	#define neighbour_physique(tlngP, nghbrP)  ( (Physique)(nghbrP)->physique )
+	#define neighbour_nghbrsNghbrNum(rhP, nghbrNum)  ( (int8_t)(rhP)->neighbours[nghbrNum].nghbrsNghbrNum )
+	#define neighbour_nghbrsNghbrNum_set(rhP, nghbrNum, nnn)  ( (rhP)->neighbours[nghbrNum].nghbrsNghbrNum = (nnn) )
+#endif
+double rhombus_derivedAngleDegrees(XY const north,  XY const south);
+
+// Is vertex0 of rhombus rhP0 the same point as vertex1 of rhP1? E.g., vertices_same(tlngP, rhP_A, north, rhP_B, east).
+#if ExactCoordinates
+	#define vertices_same(tlngP, rhP0, vertex0, rhP1, vertex1)  lattice_same( rhombus_##vertex0##Exact(rhP0),  rhombus_##vertex1##Exact(rhP1) )
+#else
+	#define vertices_same(tlngP, rhP0, vertex0, rhP1, vertex1)  points_same_2( (tlngP),  (rhP0)->vertex0,  (rhP1)->vertex1 )
+#endif
+
+// Centre and bounding box of a rhombus, field being xMin, xMax, yMin, or yMax. Those of rhombi[rhId] of a tiling, from the hot arrays if
+// HotArrays, by rhombus_hotCentre() and rhombus_hotBBox(). Where only the Rhombus is to hand, by rhombus_centre() and rhombus_bbox(), which
+// if HotArrays or CompactRhombi derive them from its corners, exactly as rhombus_append() did.
+XY   rhombus_derivedCentre(Tiling const * const tlngP,  Rhombus const * const rhP);
+BBox rhombus_derivedBBox(Tiling const * const tlngP,  Rhombus const * const rhP);
+#if HotArrays  ||  CompactRhombi
+	#define rhombus_centre(tlngP, rhP)           rhombus_derivedCentre((tlngP), (rhP))
+	#define rhombus_bbox(tlngP, rhP, field)      ( rhombus_derivedBBox((tlngP), (rhP)).field )
+#else
+	#define rhombus_centre(tlngP, rhP)           ( (void)(tlngP),  (rhP)->centre )
+	#define rhombus_bbox(tlngP, rhP, field)      ( (void)(tlngP),  (rhP)->field )
+#endif
+#if HotArrays
+	#define rhombus_hotCentre(tlngP, rhId)       ( (tlngP)->hotCentres[rhId] )
+	#define rhombus_hotBBox(tlngP, rhId, field)  ( (tlngP)->hotBBoxes[rhId].field )
+	#define hotArrays_move(tlngP, rhIdTo, rhIdFrom)  ( (tlngP)->hotCentres[rhIdTo] = (tlngP)->hotCentres[rhIdFrom],  (tlngP)->hotBBoxes[rhIdTo] = (tlngP)->hotBBoxes[rhIdFrom] )
+void    hotArrays_set(Tiling * const tlngP,  RhombId const rhId);
+void    hotArrays_derive(Tiling * const tlngP,  RhombId const rhIdFirst,  RhombId const rhIdEnd);
+void    hotArrays_free(Tiling * const tlngP);
+#else
+	#define rhombus_hotCentre(tlngP, rhId)       rhombus_centre((tlngP),  &((tlngP)->rhombi[rhId]))
+	#define rhombus_hotBBox(tlngP, rhId, field)  rhombus_bbox((tlngP),  &((tlngP)->rhombi[rhId]),  field)
+	#define hotArrays_move(tlngP, rhIdTo, rhIdFrom)
+	#define hotArrays_derive(tlngP, rhIdFirst, rhIdEnd)
+	#define hotArrays_free(tlngP)
+#endif
+
+void * bigArray_alloc(Tiling const * const tlngP,  long int const numElements,  size_t const sizeElement,  char const * const arrayName,  bool * const mappedP);
+void * bigArray_resize(Tiling const * const tlngP,  void * const p,  long int const numElementsOld,  long int const numElementsNew,  size_t const sizeElement,  char const * const arrayName,  bool * const mappedP);
+void   bigArray_free(void * const p,  long int const numElements,  size_t const sizeElement,  bool const mapped);
+void   bigArray_adviseSequential(void const * const p,  long int const numElements,  size_t const sizeElement,  bool const mapped,  bool const sequential);
+
+void rhombi_resize(Tiling * const tlngP,  long int rhombi_NumMaxNew);
+void rhombi_reserveOne(Tiling * const tlngP);
+void rhombus_append_count(Tiling * const tlngP,  Rhombus const * const rhP);
+void rhombus_append_copy(Tiling * const tlngP,  Rhombus const * const rhSourceP);
+
+#if ! CompactRhombi
 RhombId rhombus_append(
 	Tiling  * const tlngP,  // Parent tiling
 	Physique  const physique,
@@ -239,12 +513,37 @@ RhombId rhombus_append(
 	double    const xSouth,
 	double    const ySouth
 );  // rhombus_append()
+#endif
+#if ExactCoordinates
+RhombId rhombus_append_exact(
+	Tiling  * const tlngP,
+	Physique  const physique,
+	int8_t    const filledType,
+	Lattice   const north,
+	Lattice   const south
+);  // rhombus_append_exact()
+#endif
 bool rhombus_keep(
 	const Tiling * const tlngP,  Physique const physique,
 	double const xNorth,  double const yNorth,  double const xSouth,  double const ySouth
 );
 
-void rhombus_append_descendants(Tiling* tlngP, Rhombus* rhP);
+void rhombus_append_descendants(Tiling* tlngP, Tiling const * const tlngAncestorP, Rhombus* rhP, bool const byEdgeOwnership, RhombId * const childRhIds);
+long int roi_polygon(XY const * * const verticesP);
+double roi_margin(const Tiling * const tlngP);
+bool rhombus_inRegionOfInterest(Tiling const * const tlngDescendantP,  Tiling const * const tlngAncestorP,  Rhombus const * const rhAncestorP);
+bool locate_wanted(XY * const pointP,  TilingId * const tilingIdP,  double * const neighbourhoodRadiusP);
+bool locate_point(
+	Tiling  const * const tlngSeedP,
+	XY              const point,
+	TilingId        const tilingIdWanted,
+	double          const neighbourhoodRadius,
+	Located       * const locP
+);  // locate_point()
+void locate_free(Located * const locP);
+void locate_print(FILE * const fp,  XY const point,  Located const * const locP);
+int8_t rhombus_numDescendants(Tiling const * const tlngDescendantP, Tiling const * const tlngAncestorP, Rhombus const * const rhP, bool const byEdgeOwnership);
+int8_t rhombus_childOnEdge(Physique const physique,  bool const touchesN,  bool const touchesE);
 
 void tiling_empty(Tiling * const tlngP);
 
@@ -259,40 +558,86 @@ void tiling_descendant(
 	Tiling const * const tlngAncestorP
 );  // tiling_descendant()
 
+bool tilingsByPentagridQ(void);
+double pentagrid_radius(const Tiling * const tlngP);
+int  pentagridNumThreads(const Tiling * const tlngP);
+bool pentagridVerifyQ(void);
+void pentagrid_verify(Tiling const * const tlngP);
+PentagridFrame pentagrid_frame(Tiling const * const tlngP,  XY const origin,  double const angleRadians);
+void pentagrid_window(Tiling * const tlngP,  PentagridFrame const * const frameP,  BBox const window,  double const radius);
+void tiling_pentagrid(
+	Tiling * const tlngP,
+	double const init_thin_xNorth,  double const init_thin_xSouth,  double const init_thin_yNorth,  double const init_thin_ySouth,
+	XY const wantedPostScriptCentre,  double const wantedPostScriptAspect
+);  // tiling_pentagrid()
+
 void   rhombi_sort(
 	Tiling * const tlngP,
 	int orderedFn(const Rhombus * const, const Rhombus * const),
 	bool const alsoRenumber
 );  // rhombi_sort()
+bool   rhombi_sortTail_ByY(Tiling * const tlngP,  RhombId const numSorted,  RhombId * const tailRhIdsNew);
+void   rhombi_sortSpatially(Tiling * const tlngP);
+bool   rhombiSpatialOrderQ(const Tiling * const tlngP);
 void     paths_sort(Tiling * const tlngP,  int orderedFn(const Path    * const, const Path    * const) );  // Always renumber
 void pathStats_sort(Tiling * const tlngP);  // Only one sort function, always renumber
 int rhombiGt_ByY(Rhombus const * const rhP0, Rhombus const * const rhP1);
+int centresGt_ByY(XY const centre0,  XY const centre1);  // Same order as rhombiGt_ByY(), given the rhombi's centres.
+void rhombiOrder_make(
+	Tiling const * const tlngP,
+	int orderedFn(const Rhombus * const, const Rhombus * const),
+	RhombiOrder  * const orderP
+);  // rhombiOrder_make()
+void rhombiOrder_free(RhombiOrder * const orderP);
+
+uint64_t radix_keyDouble(double d);
+uint64_t radix_keyLong(long int const i);
+void radix_permutation(
+	long int   const n,
+	int8_t     const numKeys,
+	uint64_t         keyFn(void const * const context,  long int const idx,  int8_t const keyNum),
+	void const     * context,
+	long int * const perm
+);  // radix_permutation()
+void radix_permutationApply(void * const base,  long int const n,  size_t const numBytes,  long int * const perm);
+bool purgeDuplicatesByHashQ(const Tiling * const tlngP);
+bool neighboursByHashQ(const Tiling * const tlngP);
 void rhombi_purgeDuplicates(Tiling * const tlngP);
 
+void     spatialHash_init(SpatialHash * const shP,  double const pitch,  long int const numExpected);
+void     spatialHash_free(SpatialHash * const shP);
+void     spatialHash_insert(SpatialHash * const shP,  XY const xy,  long int const value);
+long int spatialHash_candidates(SpatialHash const * const shP,  XY const xy,  long int * const values,  long int const maxNumValues);
+
 void twoRhombi_Neighbourify(Tiling * const tlngP,  RhombId const rhId_A,  RhombId const rhId_B);
-void oneRhombi_Neighbourify(
-	Tiling * const tlngP,
-	RhombId const rhId_This,
-	RhombId rhId_Start,
-	RhombId const rhId_End,
-	bool const isSortedWithin
-);
 void neighbours_populate(Tiling * const tlngP);
+void neighbours_inherit(Tiling * const tlngDescendantP,  Tiling const * const tlngAncestorP,  RhombId * const childRhIds);
+void neighbours_openEdges_insert(Tiling const * const tlngP,  SpatialHash * const shP,  RhombId const rhId);
+void neighbours_openEdges_link(Tiling * const tlngP,  SpatialHash const * const shP,  RhombId const rhId);
+RhombId neighbours_openEdges_duplicate(Tiling const * const tlngP,  SpatialHash const * const shP,  RhombId const rhId);
+void neighbours_nghbrsNghbrNum_one(Tiling * const tlngP,  RhombId const rhId);
+void neighbours_canonical(Tiling * const tlngP,  RhombId const numSorted);
 
 bool holesFillQ(const Tiling * const tlngP);
+bool holesFillByWorklistQ(const Tiling * const tlngP);
+int  holesFillNumThreads(const Tiling * const tlngP);
+bool holesFillParallelVerifyQ(void);
+int  descendantsNumThreads(const Tiling * const tlngP);
+bool descendantsByEdgeOwnershipQ(const Tiling * const tlngP);
+bool descendantsInheritNeighboursQ(const Tiling * const tlngP);
+bool tilingsLowMemoryQ(void);
+bool arraysMappedQ(const Tiling * const tlngP);
+bool sortByRadixQ(const Tiling * const tlngP);
 void holesFill(Tiling * const tlngP);
 
 void verifyHypothesisedProperties(Tiling const * const tlngP);
 
 
 RhombId NextInPath_RhId(
-	const Rhombus * const rhombi,
 	const Rhombus * const rhThisP,
-	long int        const pathLength,
 	bool            const direction
 );  // NextInPath_RhId(). Negative return means non-existent. Re direction: true ==> next; false ==> prev.
 
-int  neighbourGt(       Neighbour const * const nP0,     Neighbour const * const nP1   );
 int  rhombiGt_ByPath(  Rhombus   const * const rhP0,    Rhombus   const * const rhP1  );
 int  pathGt_ByClosedEtc(Path      const * const pathP0,  Path      const * const pathP1);
 
@@ -363,7 +708,7 @@ void pathStat_export(FILE * const fp,
 
 void export_soloTiling(
 	Tiling * const tlngP,
-	clock_t const timeBeginDescendant
+	double  const timeBeginDescendant  // As wallClockSeconds()
 );  // export_soloTiling()
 
 void tiling_export(
@@ -389,6 +734,27 @@ void tilings_export(
 	unsigned long long int * const numCharsThisFileP
 );  // tilings_export()
 
+void tilings_export_part(
+	ExportFormat        const exportFormat,
+	bool exportQ(ExportWhat const exprtWhat, ExportFormat const exportFormat, const Tiling * const tlngP, const unsigned long int numLinesThisFile),
+	Tiling            * const tlngP,
+	int                 const indentDepth,
+	long int            const numTilings,
+	unsigned long int      * const partsNumLines,
+	unsigned long long int * const partsNumChars
+);  // tilings_export_part()
+void tilings_export_fromParts(
+	FILE              * const fp,
+	ExportFormat        const exportFormat,
+	Tiling      const * const tlngP,
+	int                 const indentDepth,
+	unsigned long int      const * const partsNumLines,
+	unsigned long long int const * const partsNumChars,
+	unsigned long int * const numLinesThisFileP,
+	unsigned long long int * const numCharsThisFileP
+);  // tilings_export_fromParts()
+void tilings_export_removeParts(Tiling const * const tlngP,  ExportFormat const exportFormat);
+
 void tiling_export_PaintRhombiPS(
 	FILE* const fp,
 	Tiling const      * const tlngP,
@@ -408,6 +774,7 @@ void exportColourSVG(char * const strA,  char * const strB,  bool * const isWhit
 void tiling_export_PaintRhombiSVG(
 	FILE* const fp,
 	Tiling const      * const tlngP,
+	RhombiOrder const * const orderP,
 	unsigned long int * const numLinesThisFileP,
 	unsigned long long int * const numCharsThisFileP
 );
@@ -415,6 +782,7 @@ void tiling_export_PaintRhombiSVG(
 void tiling_export_PaintArcsSVG(
 	FILE* const fp,
 	Tiling const      * const tlngP,
+	RhombiOrder const * const orderP,
 	unsigned long int * const numLinesThisFileP,
 	unsigned long long int * const numCharsThisFileP
 );  // tiling_export_PaintArcsSVG()
@@ -0,0 +1,596 @@
+// By and copyright Julian D. A. Wiseman of www.jdawiseman.com, April 2025
+// Released under GNU General Public License, Version 3, https://www.gnu.org/licenses/gpl-3.0.txt
+// pentagrid.c, in PenroseC
+
+#include "penrose.h"
+
+/*
+	An alternative to substitution, chosen by tilingsByPentagridQ(): each tiling made directly, by de Bruijn's pentagrid.
+
+	There are five families of parallel lines, family j being the points x, in units of the edge length, at which x.u[j] + gamma[j]
+	is an integer, u[j] being the unit vector at 72j degrees from the seed's north-to-south direction. Each intersection of a line
+	of family r with a line of family s, r < s, is one rhombus, with edges e[r] and e[s]: fat if s-r is 1 or 4, else thin.
+	Its vertices are V, V+e[r], V+e[s], V+e[r]+e[s], where V = Sum_j K[j] e[j], K[r] and K[s] being the indices of the two lines,
+	and the other K[j] = ceil(x.u[j] + gamma[j]). So each rhombus is made in O(1), independently of the others, and once only:
+	no duplicates to purge, and no holes to fill.
+
+	Sum_j gamma[j] is an integer, G, and the index of a vertex, Sum_j K[j], is one of G+1 to G+4. Of V and V+e[r]+e[s], which are
+	the ends of the north-south diagonal, the north is that with an index of G+2 or G+3.
+
+	The gammas are chosen so that the tiling is that made by substitution from main()'s seed, with the same north, edge length,
+	and Lattice. Adding v.u[j] to each gamma[j], for any vector v, moves only x, not the rhombi. So what matter are G, and the
+	gammas' component along cos(144j), sin(144j), their offset in de Bruijn's 'internal space': here gamma[j] = G/5 + c cos(144j).
+	Each deflation multiplies G by 3, mod 5, and c by -1/GoldenRatio: so at tilingId t, G = 3^(t+1) mod 5, c = c0 (-1/GoldenRatio)^t.
+	Each rhombus made by substitution bounds c0. Those of tilingIds 1 to 3 confine it to the triangle with vertices
+	(-GoldenRatioSquare/5, +-0.4 Sin72) and (-2/(5 GoldenRatio), 0), which those of tilingIds 4 to 8 leave unchanged.
+	So c0 is its centroid, -4 GoldenRatio / 15, and every rhombus made by substitution is one of the pentagrid's, as checked by
+	pentagrid_verify(): where both have rhombi, they are the same. Here the tiling is whole to the edge of a disc of radius
+	pentagrid_radius(), rather than ragged.
+
+	Any window, a BBox, can be made alone, by pentagrid_window(), needing only the PentagridFrame of its tilingId. Windows sharing
+	edges make each rhombus once, so tiling_pentagrid() can make the disc as strips, in parallel, as chosen by pentagridNumThreads().
+	A point x of the grid is near (5/2) x in units of edge length, rotated by the frame's angle, Sum_j gamma[j] e[j] being zero,
+	and a rhombus's centre within 4 edges of that of its intersection. So a window needs only the lines crossing it, widened
+	a little: for each line of family r, only the lines of family s crossing it there.
+*/
+
+#define Pentagrid_c0 (-4 * GoldenRatio / 15)
+
+
+// Sum_j gamma[j], the G above.
+static int8_t pentagrid_gammasSum(TilingId const tilingId)
+{
+	int8_t gammasSum = 3;
+	TilingId t;
+	for( t = 0  ;  t < tilingId  ;  t++ )
+		gammasSum = (3 * gammasSum) % 5;
+	return gammasSum;
+}  // pentagrid_gammasSum()
+
+
+// The gammas, and the unit vectors u[j], as above.
+static void pentagrid_gammasUnits(TilingId const tilingId,  double gamma[5],  XY unit[5])
+{
+	double const c = Pentagrid_c0 * pow(-GoldenRatioReciprocal,  tilingId);
+	int8_t j;
+	for( j = 0  ;  j < 5  ;  j++ )
+	{
+		gamma[j] = pentagrid_gammasSum(tilingId) / 5.0  +  c * cos(j * 144 / DegreesPerRadian);
+		unit[j].x = cos(j * 72 / DegreesPerRadian);
+		unit[j].y = sin(j * 72 / DegreesPerRadian);
+	}  // for( j ... )
+}  // pentagrid_gammasUnits()
+
+
+// Of the rhombus at the intersection of line nr of family r and line ns of family s, sets K[].
+static void pentagrid_K(
+	double  const gamma[5],
+	XY      const unit[5],
+	int8_t  const r,   int8_t   const s,
+	long int const nr,  long int const ns,
+	int32_t       K[5]
+)
+{
+	double const det = unit[r].x * unit[s].y  -  unit[r].y * unit[s].x;
+	double const a = nr - gamma[r];
+	double const b = ns - gamma[s];
+	XY const grid = {.x = (a * unit[s].y  -  b * unit[r].y) / det,  .y = (b * unit[r].x  -  a * unit[s].x) / det};
+	int8_t j;
+
+	for( j = 0  ;  j < 5  ;  j++ )
+		if( j == r )
+			K[j] = nr;
+		else if( j == s )
+			K[j] = ns;
+		else
+			K[j] = (int32_t)ceil(grid.x * unit[j].x  +  grid.y * unit[j].y  +  gamma[j]);
+}  // pentagrid_K()
+
+
+#if ExactCoordinates
+// Sum_j K[j] e[j] as a Lattice, relative to the seed's north, being the Lattice's origin.
+static Lattice pentagrid_lattice(int32_t const K[5])
+{
+	return (Lattice){ .a = {K[0] - K[4],  K[1] - K[4],  K[2] - K[4],  K[3] - K[4]} };
+}  // pentagrid_lattice()
+
+
+// Whether the rhombus is one of the pentagrid tiling of its tilingId: so that, with north and south, it has the K[] of pentagrid_K().
+static bool pentagrid_hasRhombus(
+	double  const gamma[5],
+	XY      const unit[5],
+	int8_t  const gammasSum,
+	Physique const physique,
+	Lattice const north,
+	Lattice const south
+)
+{
+	int32_t const KNorth[5] = {north.a[0],  north.a[1],  north.a[2],  north.a[3],  0};
+	int32_t const KSouth[5] = {south.a[0],  south.a[1],  south.a[2],  south.a[3],  0};
+	int32_t KV[5], K[5], diff[5], diffMin;
+	int8_t j, r = -1, s = -1, numOnes = 0;
+	long int indexV, indexWanted;
+	bool northIsV;
+
+	// V is the end from which the other is e[r]+e[s], as a Lattice being unique only up to adding (1,1,1,1,1), Sum_j e[j] being 0.
+	for( j = 0  ;  j < 5  ;  j++ )
+		diff[j] = KSouth[j] - KNorth[j];
+	diffMin = diff[0];
+	for( j = 1  ;  j < 5  ;  j++ )
+		if( diff[j] < diffMin )
+			diffMin = diff[j];
+	northIsV = true;
+	for( j = 0  ;  j < 5  ;  j++ )
+		if( diff[j] - diffMin > 1 )
+			return false;
+		else if( diff[j] - diffMin == 1 )
+			numOnes ++;
+	if( 3 == numOnes )  // So south to north is e[r]+e[s], the two not at diffMin + 1.
+	{
+		northIsV = false;
+		diffMin ++;
+	}
+	else if( 2 != numOnes )
+		return false;
+	for( j = 0  ;  j < 5  ;  j++ )
+		if( (northIsV  &&  diff[j] - diffMin == 1)  ||  (! northIsV  &&  diff[j] - diffMin == -1) )
+		{
+			if( r < 0 )
+				r = j;
+			else
+				s = j;
+		}  // if( in e[r]+e[s] )
+	if( physique != ( 1 == s - r  ||  4 == s - r  ?  Fat  :  Thin ) )
+		return false;
+
+	// V's index must be G+2 if V is the north, else G+1.
+	indexV = 0;
+	for( j = 0  ;  j < 5  ;  j++ )
+		indexV += (northIsV ? KNorth[j] : KSouth[j]);
+	indexWanted = gammasSum + (northIsV ? 2 : 1);
+	if( 0 != ((indexWanted - indexV) % 5 + 5) % 5 )
+		return false;
+	for( j = 0  ;  j < 5  ;  j++ )
+		KV[j] = (northIsV ? KNorth[j] : KSouth[j])  +  (indexWanted - indexV) / 5;
+
+	pentagrid_K(gamma,  unit,  r,  s,  KV[r],  KV[s],  K);
+	for( j = 0  ;  j < 5  ;  j++ )
+		if( K[j] != KV[j] )
+			return false;
+	return true;
+}  // pentagrid_hasRhombus()
+#endif  // ExactCoordinates
+
+
+// If pentagridVerifyQ(), checks that every rhombus is one of the pentagrid tiling, so that, where both have rhombi, substitution
+// and tiling_pentagrid() make the same tiling. Needs ExactCoordinates.
+void pentagrid_verify(Tiling const * const tlngP)
+{
+#if ExactCoordinates
+	double gamma[5];
+	XY unit[5];
+	int8_t const gammasSum = pentagrid_gammasSum(tlngP->tilingId);
+	RhombId rhId,  rhId_FirstMissing = -1;
+	long int numMissing = 0;
+	Rhombus const * rhP;
+
+	if( ! pentagridVerifyQ() )
+		return;
+
+	pentagrid_gammasUnits(tlngP->tilingId,  gamma,  unit);
+	for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++ )
+	{
+		rhP = &(tlngP->rhombi[rhId]);
+		if( ! pentagrid_hasRhombus(gamma,  unit,  gammasSum,  rhP->physique,  rhombus_northExact(rhP),  rhombus_southExact(rhP)) )
+		{
+			if( 0 == numMissing )
+				rhId_FirstMissing = rhId;
+			numMissing ++;
+		}  // if( ! pentagrid_hasRhombus() )
+	}  // for( rhId ... )
+
+	if( 0 == numMissing )
+		printf("pentagrid_verify(): tilingId=%" PRIi8 ", all %li rhombi are of the pentagrid.\n",  tlngP->tilingId,  tlngP->numFats + tlngP->numThins);
+	else
+	{
+		fprintf(stderr, "pentagrid_verify(): !!! tilingId=%" PRIi8 ", %li of %li rhombi not of the pentagrid, the first being rhId=%li !!!\n",
+			tlngP->tilingId,  numMissing,  tlngP->numFats + tlngP->numThins,  rhId_FirstMissing);
+		fflush(stderr);
+	}
+	fflush(stdout);
+#else
+	(void)tlngP;
+#endif  // ExactCoordinates
+}  // pentagrid_verify()
+
+
+// The frame of tlngP's tilingId, edgeLength, and Lattice, origin being the seed's north, and angleRadians that of e[0].
+PentagridFrame pentagrid_frame(Tiling const * const tlngP,  XY const origin,  double const angleRadians)
+{
+	PentagridFrame frame;
+	int8_t j;
+
+	pentagrid_gammasUnits(tlngP->tilingId,  frame.gamma,  frame.unit);
+	frame.gammasSum    = pentagrid_gammasSum(tlngP->tilingId);
+	frame.origin       = origin;
+	frame.angleRadians = angleRadians;
+	frame.edgeLength   = tlngP->edgeLength;
+	for( j = 0  ;  j < 5  ;  j++ )
+	{
+		frame.basis[j].x = tlngP->edgeLength * cos(angleRadians + j * 72 / DegreesPerRadian);
+		frame.basis[j].y = tlngP->edgeLength * sin(angleRadians + j * 72 / DegreesPerRadian);
+	}  // for( j ... )
+	return frame;
+}  // pentagrid_frame()
+
+
+// Appends to tlngP each rhombus of the pentagrid whose centre is in window, with xMin <= x < xMax and yMin <= y < yMax, and,
+// if radius > 0, is within radius of the frame's origin. Reads tlngP only as rhombus_append() does, so separate windows can be
+// made at once, each into its own tiling.
+void pentagrid_window(Tiling * const tlngP,  PentagridFrame const * const frameP,  BBox const window,  double const radius)
+{
+	double const margin = 6 * frameP->edgeLength;  // More than the 4 edges between a centre and (5/2) x, to spare rounding.
+	double const cosAngle = cos(frameP->angleRadians),  sinAngle = sin(frameP->angleRadians);
+	double const scale = 2.5 * frameP->edgeLength;
+	XY const corners[4] = {
+		{.x = window.xMin - margin,  .y = window.yMin - margin},
+		{.x = window.xMax + margin,  .y = window.yMin - margin},
+		{.x = window.xMax + margin,  .y = window.yMax + margin},
+		{.x = window.xMin - margin,  .y = window.yMax + margin}
+	};
+	XY quad[4], vertex, centre;
+	double along[4], at, fraction, lineMin, lineMax, crossMin, crossMax, cross;
+	int32_t K[5], KOpposite[5];
+	long int nr, ns, index;
+	int8_t j, k, r, s;
+	bool crosses;
+	Physique physique;
+	RhombId rhId_new;
+
+	if( window.xMin >= window.xMax  ||  window.yMin >= window.yMax )
+		return;
+
+	// The widened window in the grid's space, a rotated rectangle.
+	for( k = 0  ;  k < 4  ;  k++ )
+	{
+		quad[k].x = ( (corners[k].x - frameP->origin.x) * cosAngle  +  (corners[k].y - frameP->origin.y) * sinAngle ) / scale;
+		quad[k].y = ( (corners[k].y - frameP->origin.y) * cosAngle  -  (corners[k].x - frameP->origin.x) * sinAngle ) / scale;
+	}  // for( k ... )
+
+	for( r = 0  ;  r < 4  ;  r++ )
+	{
+		lineMin = DBL_MAX;
+		lineMax = -DBL_MAX;
+		for( k = 0  ;  k < 4  ;  k++ )
+		{
+			along[k] = quad[k].x * frameP->unit[r].x  +  quad[k].y * frameP->unit[r].y;
+			if( along[k] < lineMin )  lineMin = along[k];
+			if( along[k] > lineMax )  lineMax = along[k];
+		}  // for( k ... )
+
+		for( s = r + 1  ;  s < 5  ;  s++ )
+		{
+			physique = ( 1 == s - r  ||  4 == s - r  ?  Fat  :  Thin );
+			for( nr = (long int)ceil(lineMin + frameP->gamma[r])  ;  nr <= (long int)floor(lineMax + frameP->gamma[r])  ;  nr++ )
+			{
+				// Where line nr crosses the quad's edges, the extent along u[s], so the lines of family s crossing it within.
+				at = nr - frameP->gamma[r];
+				crossMin = DBL_MAX;
+				crossMax = -DBL_MAX;
+				crosses = false;
+				for( k = 0  ;  k < 4  ;  k++ )
+				{
+					int8_t const kNext = (k + 1) % 4;
+					if( along[k] == along[kNext]  ||  (along[k] - at) * (along[kNext] - at) > 0 )
+						continue;
+					fraction = (at - along[k]) / (along[kNext] - along[k]);
+					cross
+						= (quad[k].x + fraction * (quad[kNext].x - quad[k].x)) * frameP->unit[s].x
+						+ (quad[k].y + fraction * (quad[kNext].y - quad[k].y)) * frameP->unit[s].y;
+					if( cross < crossMin )  crossMin = cross;
+					if( cross > crossMax )  crossMax = cross;
+					crosses = true;
+				}  // for( k ... )
+				if( ! crosses )
+					continue;
+
+				for( ns = (long int)ceil(crossMin + frameP->gamma[s])  ;  ns <= (long int)floor(crossMax + frameP->gamma[s])  ;  ns++ )
+				{
+					pentagrid_K(frameP->gamma,  frameP->unit,  r,  s,  nr,  ns,  K);
+					index = 0;
+					for( j = 0  ;  j < 5  ;  j++ )
+						index += K[j];
+
+					vertex = frameP->origin;
+					for( j = 0  ;  j < 5  ;  j++ )
+					{
+						vertex.x += K[j] * frameP->basis[j].x;
+						vertex.y += K[j] * frameP->basis[j].y;
+					}  // for( j ... )
+					centre.x = vertex.x  +  (frameP->basis[r].x + frameP->basis[s].x) / 2;
+					centre.y = vertex.y  +  (frameP->basis[r].y + frameP->basis[s].y) / 2;
+					if( centre.x < window.xMin  ||  centre.x >= window.xMax  ||  centre.y < window.yMin  ||  centre.y >= window.yMax )
+						continue;
+					if( radius > 0  &&  pow(centre.x - frameP->origin.x,  2)  +  pow(centre.y - frameP->origin.y,  2)  >  radius * radius )
+						continue;
+
+					for( j = 0  ;  j < 5  ;  j++ )
+						KOpposite[j] = K[j];
+					KOpposite[r] ++;
+					KOpposite[s] ++;
+
+					// V has index G+1 or G+2; the north has index G+2 or G+3.
+					bool const northOpposite = ( index  ==  frameP->gammasSum + 1 );
+#if ExactCoordinates
+					rhId_new = rhombus_append_exact(
+						tlngP,
+						physique,
+						false,  // not filled hole
+						pentagrid_lattice(northOpposite ? KOpposite : K),
+						pentagrid_lattice(northOpposite ? K : KOpposite)
+					);
+#else
+					XY const opposite = {.x = vertex.x + frameP->basis[r].x + frameP->basis[s].x,  .y = vertex.y + frameP->basis[r].y + frameP->basis[s].y};
+					if( northOpposite )
+						rhId_new = rhombus_append(tlngP,  physique,  false,  opposite.x,  opposite.y,  vertex.x,  vertex.y);
+					else
+						rhId_new = rhombus_append(tlngP,  physique,  false,  vertex.x,  vertex.y,  opposite.x,  opposite.y);
+#endif
+					(void)rhId_new;  // -1 if not rhombus_keep(), which is fine.
+				}  // for( ns ... )
+			}  // for( nr ... )
+		}  // for( s ... )
+	}  // for( r ... )
+}  // pentagrid_window()
+
+
+typedef struct  // PentagridWindow
+{
+	Tiling                  buffer;   // Scratch tiling, holding this window's rhombi.
+	PentagridFrame const  * frameP;
+	BBox                    window;
+	double                  radius;
+} PentagridWindow;
+
+
+// Thread body: one window's rhombi, into its own buffer.
+static void * pentagrid_window_generate(void * const arg)
+{
+	PentagridWindow * const windowP = (PentagridWindow *)arg;
+	pentagrid_window( &(windowP->buffer),  windowP->frameP,  windowP->window,  windowP->radius );
+	return NULL;
+}  // pentagrid_window_generate()
+
+
+// Parallel equivalent of pentagrid_window(tlngP, frameP, disc, radius). The disc is split into PentagridWindowsPerThread * numThreads
+// horizontal strips, done in waves of numThreads, each thread making one strip into its own calloc()'d rhombi_Scratch buffer, as
+// descendants_append_parallel() in tilings.c. Then, serially and in strip order, the wave's buffers are copied into tlngP and freed.
+// The order of the rhombi differs from that of a single window, but not after rhombi_sort(), centres being distinct.
+#define PentagridWindowsPerThread 4
+static void pentagrid_windows_parallel(
+	Tiling * const tlngP,
+	PentagridFrame const * const frameP,
+	BBox const disc,
+	double const radius,
+	int const numThreads
+)
+{
+	long int const numWindows = (long int)numThreads * PentagridWindowsPerThread;
+	long int windowNum, waveStart, waveEnd;
+	RhombId rhId;
+	PentagridWindow *windows, *windowP;
+	pthread_t *threads;
+	bool *threadStarted;
+
+	windows       = malloc( numThreads * sizeof(PentagridWindow) );
+	threads       = malloc( numThreads * sizeof(pthread_t) );
+	threadStarted = malloc( numThreads * sizeof(bool) );
+	if( NULL == windows  ||  NULL == threads  ||  NULL == threadStarted )
+	{
+		fprintf(stderr, "pentagrid_windows_parallel(): !!! malloc() failure, numThreads=%i !!!\n", numThreads);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+
+	for( waveStart = 0  ;  waveStart < numWindows  ;  waveStart = waveEnd )
+	{
+		waveEnd = waveStart + numThreads;
+		if( waveEnd > numWindows )
+			waveEnd = numWindows;
+
+		for( windowNum = waveStart  ;  windowNum < waveEnd  ;  windowNum ++ )
+		{
+			windowP = &(windows[windowNum - waveStart]);
+			windowP->frameP = frameP;
+			windowP->radius = radius;
+			windowP->window = disc;  // Strips sharing edges, each computed alike, so no rhombus is in two or none.
+			windowP->window.yMin = disc.yMin  +  (disc.yMax - disc.yMin) * windowNum       / numWindows;
+			windowP->window.yMax = ( windowNum + 1 == numWindows  ?  disc.yMax  :  disc.yMin  +  (disc.yMax - disc.yMin) * (windowNum + 1) / numWindows );
+
+			windowP->buffer = *tlngP;  // Copies tilingId, edgeLength, Lattice, etc, as might be used by rhombus_keep().
+			windowP->buffer.numFats  = 0;
+			windowP->buffer.numThins = 0;
+			windowP->buffer.rhombi_Mapped = false;
+			windowP->buffer.rhombi_Scratch = true;  // So no hot arrays, recomputed by rhombus_append_copy(), and nothing mapped.
+#if HotArrays
+			windowP->buffer.hot_NumMax = 0;
+			windowP->buffer.hotCentres = NULL;
+			windowP->buffer.hotBBoxes  = NULL;
+			windowP->buffer.hotCentres_Mapped = false;
+			windowP->buffer.hotBBoxes_Mapped  = false;
+#endif
+			// As in tiling_pentagrid(), but of the strip's rectangle. Any underestimate is handled by rhombi_reserveOne().
+			windowP->buffer.rhombi_NumMax
+				= (disc.xMax - disc.xMin) * (windowP->window.yMax - windowP->window.yMin) / pow(tlngP->edgeLength, 2) / 0.812299
+				+ 3 * (disc.xMax - disc.xMin) / tlngP->edgeLength  +  256;
+			// calloc() not malloc(): rhombus_append() leaves some fields unset, so copies should be as from fresh memory.
+			windowP->buffer.rhombi = calloc( windowP->buffer.rhombi_NumMax,  sizeof(Rhombus) );
+			if( NULL == windowP->buffer.rhombi )
+			{
+				fprintf(stderr, "pentagrid_windows_parallel(): !!! NULL == buffer.rhombi, windowNum=%li !!!\n", windowNum);
+				fflush(stderr);
+				exit(EXIT_FAILURE);
+			}
+
+			threadStarted[windowNum - waveStart] = ( 0 == pthread_create(&(threads[windowNum - waveStart]), NULL, &pentagrid_window_generate, windowP) );
+			if( ! threadStarted[windowNum - waveStart] )
+				pentagrid_window_generate(windowP);  // Couldn't start a thread, so do it here.
+		}  // for( windowNum ... )
+
+		for( windowNum = waveStart  ;  windowNum < waveEnd  ;  windowNum ++ )
+			if( threadStarted[windowNum - waveStart] )
+				pthread_join(threads[windowNum - waveStart], NULL);
+
+		for( windowNum = waveStart  ;  windowNum < waveEnd  ;  windowNum ++ )
+		{
+			windowP = &(windows[windowNum - waveStart]);
+			for( rhId = 0  ;  rhId < windowP->buffer.numFats + windowP->buffer.numThins  ;  rhId ++ )
+				rhombus_append_copy( tlngP,  windowP->buffer.rhombi + rhId );
+			free(windowP->buffer.rhombi);
+			windowP->buffer.rhombi = NULL;
+		}  // for( windowNum ... )
+	}  // for( waveStart ... )
+
+	free(threadStarted);
+	free(threads);
+	free(windows);
+}  // pentagrid_windows_parallel()
+
+
+void tiling_pentagrid(
+	Tiling * const tlngP,
+	double   const init_thin_xNorth,  double const init_thin_xSouth,
+	double   const init_thin_yNorth,  double const init_thin_ySouth,
+	XY const wantedPostScriptCentre,  double const wantedPostScriptAspect
+)
+{
+	double const timeBegin = wallClockSeconds();
+	double timeBeginPart;  // Wall-clock, as wallClockSeconds(), not clock(), which sums the threads' CPU times.
+	double const angleRadians = atan2(init_thin_ySouth - init_thin_yNorth,  init_thin_xSouth - init_thin_xNorth);
+	int8_t const gammasSum = pentagrid_gammasSum(tlngP->tilingId);
+	double radius;
+	int numThreads;
+	PentagridFrame frame;
+	BBox disc;
+
+	printf("tiling_pentagrid(): tilingId=%" PRIi8 ", starting tiling_pentagrid(), Sum gamma=%i, c=%0.9lf.\n",
+		tlngP->tilingId,  (int)gammasSum,  Pentagrid_c0 * pow(-GoldenRatioReciprocal,  tlngP->tilingId));  fflush(stdout);
+
+	tlngP->rhombi_NumMax = 0;
+	tlngP->rhombi = NULL;
+	tlngP->rhombi_Mapped = false;
+	tlngP->rhombi_Spatial = false;
+	tlngP->rhombi_Scratch = false;
+	tlngP->arrays_Private = false;
+	tlngP->numFats = 0;
+	tlngP->numThins = 0;
+	tlngP->path_NumMax = 0;
+	tlngP->path = NULL;
+	tlngP->path_Mapped = false;
+	tlngP->pathRhIds = NULL;
+	tlngP->pathRhIds_Mapped = false;
+	tlngP->numPathsClosed = 0;
+	tlngP->numPathsOpen = 0;
+	tlngP->pathStats_NumMax = 0;
+	tlngP->pathStat = NULL;
+	tlngP->pathStat_Mapped = false;
+	tlngP->numPathStats = 0;  // This needed when paths_sort() with pathStat not yet assigned.
+#if HotArrays
+	tlngP->hot_NumMax = 0;
+	tlngP->hotCentres = NULL;
+	tlngP->hotBBoxes  = NULL;
+	tlngP->hotCentres_Mapped = false;
+	tlngP->hotBBoxes_Mapped  = false;
+#endif
+
+	tlngP->wantedPostScriptCentre        = wantedPostScriptCentre;
+	tlngP->wantedPostScriptAspect        = wantedPostScriptAspect;
+	tlngP->wantedPostScriptHalfWidth     = 0;
+	tlngP->wantedPostScriptNumberRhombi = 0;
+	tlngP->wantedPostScriptNumberPaths   = 0;
+	tlngP->roi_numVertices    = 0;  // No ancestors to prune.
+	tlngP->roi_vertices       = NULL;
+	tlngP->roi_marginDistance = 0;
+	tlngP->anyPathsVeryClosed = false;
+
+	// As tiling_initial() then tiling_descendant(): the seed's edge, divided by GoldenRatio per tilingId.
+	tlngP->edgeLength
+		= sqrt( pow(init_thin_xNorth - init_thin_xSouth, 2) + pow(init_thin_yNorth - init_thin_ySouth, 2) ) * GoldenRatio
+		* pow(GoldenRatioReciprocal,  tlngP->tilingId);
+#if ExactCoordinates
+	lattice_basis_initial(tlngP,  (XY){.x=init_thin_xNorth,  .y=init_thin_yNorth},  angleRadians);
+#endif
+	frame = pentagrid_frame(tlngP,  (XY){.x=init_thin_xNorth,  .y=init_thin_yNorth},  angleRadians);
+
+	// The disc's bounding box, widened by an edge so that no centre in the disc is on its half-open upper edges.
+	radius = pentagrid_radius(tlngP);
+	disc.xMin = init_thin_xNorth - radius - tlngP->edgeLength;
+	disc.xMax = init_thin_xNorth + radius + tlngP->edgeLength;
+	disc.yMin = init_thin_yNorth - radius - tlngP->edgeLength;
+	disc.yMax = init_thin_yNorth + radius + tlngP->edgeLength;
+
+	// Area of the disc over the mean area of a rhombus, fats:thins being GoldenRatio:1, so (GoldenRatio*Sin72 + Sin36)/GoldenRatioSquare = 0.8123.
+	// Plus a little for the boundary. Any underestimate is handled by rhombi_reserveOne() growing the array.
+	tlngP->rhombi_NumMax = (180 / DegreesPerRadian) * pow(radius / tlngP->edgeLength,  2) / 0.812299  +  6 * radius / tlngP->edgeLength  +  256;
+	if( tlngP->rhombi_NumMax > RhombId_NumMax )
+	{
+		fprintf(stderr, "tiling_pentagrid(): !!! rhombi_NumMax=%li too big for Neighbour.rhId: set CompactRhombi and CompactNeighbours to false !!!\n", tlngP->rhombi_NumMax);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}  // Too big for Neighbour.rhId
+	tlngP->rhombi = bigArray_alloc(tlngP,  tlngP->rhombi_NumMax,  sizeof(Rhombus),  "rhombi",  &(tlngP->rhombi_Mapped));
+	if( NULL == tlngP->rhombi )
+	{
+		fprintf(stderr, "tiling_pentagrid(): !!! NULL == tlng.rhombi !!!\n");
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}  // NULL == tlngP->rhombi
+
+	timeBeginPart = wallClockSeconds();
+	numThreads = pentagridNumThreads(tlngP);
+	if( numThreads > 1 )
+		pentagrid_windows_parallel(tlngP,  &frame,  disc,  radius,  numThreads);
+	else
+	{
+		numThreads = 1;
+		pentagrid_window(tlngP,  &frame,  disc,  radius);
+	}
+	printf("tiling_pentagrid(): tilingId=%" PRIi8 ", %0.3lfs for pentagrid within radius=%0.6lf, with numThreads=%i, resulting in #Fats=%li #Thins=%li, #Fats+#Thins=%li\n",
+		tlngP->tilingId,
+		wallClockSeconds() - timeBeginPart,
+		radius,
+		numThreads,
+		tlngP->numFats,  tlngP->numThins,  tlngP->numFats + tlngP->numThins
+	);  fflush(stdout);
+
+	// From here as tiling_descendant(), except no purging of duplicates and no holesFill(), neither being needed.
+	timeBeginPart = wallClockSeconds();
+	rhombi_sort(tlngP,  &rhombiGt_ByY,  false);
+	neighbours_populate(tlngP);
+	printf("tiling_pentagrid(): tilingId=%" PRIi8 ", %0.3lfs for neighbours_populate()\n",
+		tlngP->tilingId,
+		wallClockSeconds() - timeBeginPart
+	);  fflush(stdout);
+
+	if( rhombiSpatialOrderQ(tlngP) )
+		rhombi_sortSpatially(tlngP);
+
+	timeBeginPart = wallClockSeconds();
+	paths_populate(tlngP);
+	wanted_populate(tlngP);
+	insideness_populate(tlngP);
+	pathStats_populate(tlngP);
+	printf("tiling_pentagrid(): tilingId=%" PRIi8 ", %0.3lfs for paths, wanted, insideness, and pathStats, with #PathsClosed=%li, #PathsOpen=%li, #PathStats=%li\n",
+		tlngP->tilingId,
+		wallClockSeconds() - timeBeginPart,
+		tlngP->numPathsClosed,  tlngP->numPathsOpen,  tlngP->numPathStats
+	);  fflush(stdout);
+
+	verifyHypothesisedProperties(tlngP);
+
+	double const angMultiple = angleRadians * DegreesPerRadian / 18;
+	tlngP->axisAligned = ( fabs(round(angMultiple) - angMultiple) < 0.000005 );  // As tiling_initial().
+
+	export_soloTiling(tlngP,  timeBegin);
+	printf("tiling_pentagrid(): tilingId=%" PRIi8 ", ending tiling_pentagrid().\n", tlngP->tilingId);  fflush(stdout);
+}  // tiling_pentagrid()
@@ -6,6 +6,8 @@
 
 void verifyHypothesisedProperties(Tiling const * const tlngP)
 {
+	pentagrid_verify(tlngP);
+
 /*
 	bool hypothesis;
 	RhombId rhId_outer, rhId_inner;
@@ -34,9 +36,9 @@ void verifyHypothesisedProperties(Tiling const * const tlngP)
 				rhInnerP = tlngP->rhombi + rhId_inner;
 				numTests ++;
 				if(
-					(fabs(rhOuterP->south.x - rhInnerP->north.x) < threshold  &&  fabs(rhOuterP->south.y - rhInnerP->north.y) < threshold) ||
-					(fabs(rhOuterP->south.x - rhInnerP->east.x ) < threshold  &&  fabs(rhOuterP->south.y - rhInnerP->east.y ) < threshold) ||
-					(fabs(rhOuterP->south.x - rhInnerP->west.x ) < threshold  &&  fabs(rhOuterP->south.y - rhInnerP->west.y ) < threshold)
+					(fabs(rhombus_south(tlngP, rhOuterP).x - rhombus_north(tlngP, rhInnerP).x) < threshold  &&  fabs(rhombus_south(tlngP, rhOuterP).y - rhombus_north(tlngP, rhInnerP).y) < threshold) ||
+					(fabs(rhombus_south(tlngP, rhOuterP).x - rhombus_east(tlngP, rhInnerP).x ) < threshold  &&  fabs(rhombus_south(tlngP, rhOuterP).y - rhombus_east(tlngP, rhInnerP).y ) < threshold) ||
+					(fabs(rhombus_south(tlngP, rhOuterP).x - rhombus_west(tlngP, rhInnerP).x ) < threshold  &&  fabs(rhombus_south(tlngP, rhOuterP).y - rhombus_west(tlngP, rhInnerP).y ) < threshold)
 				)
 				{
 					hypothesis = false;
@@ -75,8 +77,8 @@ hypothesis = true;
 				{
 					numTests ++;
 					if(
-						(fabs(rhOuterP->south.x - rhInnerP->north.x) < threshold  &&  fabs(rhOuterP->south.y - rhInnerP->north.y) < threshold) ||
-						(fabs(rhOuterP->north.x - rhInnerP->south.x) < threshold  &&  fabs(rhOuterP->north.y - rhInnerP->south.y) < threshold)
+						(fabs(rhombus_south(tlngP, rhOuterP).x - rhombus_north(tlngP, rhInnerP).x) < threshold  &&  fabs(rhombus_south(tlngP, rhOuterP).y - rhombus_north(tlngP, rhInnerP).y) < threshold) ||
+						(fabs(rhombus_north(tlngP, rhOuterP).x - rhombus_south(tlngP, rhInnerP).x) < threshold  &&  fabs(rhombus_north(tlngP, rhOuterP).y - rhombus_south(tlngP, rhInnerP).y) < threshold)
 						)
 					{
 						hypothesis = false;
@@ -4,51 +4,69 @@
 
 #include "penrose.h"
 
-int rhombiGt_ByY(Rhombus const * const rhP0, Rhombus const * const rhP1)
+int centresGt_ByY(XY const centre0,  XY const centre1)
 {
-	if(     rhP0->centre.y > rhP1->centre.y ) return +1 ;
-	if(     rhP0->centre.y < rhP1->centre.y ) return -1 ;
-	if(     rhP0->centre.x > rhP1->centre.x ) return +1 ;
-	if(     rhP0->centre.x < rhP1->centre.x ) return -1 ;
+	if(     centre0.y > centre1.y ) return +1 ;
+	if(     centre0.y < centre1.y ) return -1 ;
+	if(     centre0.x > centre1.x ) return +1 ;
+	if(     centre0.x < centre1.x ) return -1 ;
 	return 0;
+}  // centresGt_ByY()
+
+
+// As a qsort() comparator there is no tiling, so if CompactRhombi no centre: rhombi_sort() then sorts by radix, and so never calls this.
+int rhombiGt_ByY(Rhombus const * const rhP0, Rhombus const * const rhP1)
+{
+#if CompactRhombi
+	fprintf(stderr, "Error in rhombiGt_ByY: with CompactRhombi, rhombi can be ordered only by radix or by centresGt_ByY().\n");
+	fflush(stderr);
+	exit(EXIT_FAILURE);
+#else
+	return centresGt_ByY( rhombus_centre(NULL, rhP0),  rhombus_centre(NULL, rhP1) );
+#endif
 }  // rhombiGt_ByY()
 
 
-void rhombi_purgeDuplicates(Tiling * const tlngP)
+// Sorts by y, then compares each rhombus with the already-found uniques of similar y. Returns the number of uniques.
+static long int rhombi_purgeDuplicates_sorted(Tiling * const tlngP)
 {
 	RhombId        rhId1, rhId2;
 	long int       numUniques = 0;
 	bool           isUnique;
+#if ! ExactCoordinates
 	double const   thresholdSame = tlngP->edgeLength * 0.01 ;  // Arbitrary constant, smaller than 1, bigger than machine-precision epsilon
+#endif
 	long int const numRhombi = tlngP->numFats + tlngP->numThins;
 
-	if( tlngP->numFats < 2  &&  tlngP->numThins < 2 )
-		return;
-
 	rhombi_sort(tlngP,  &rhombiGt_ByY,  false);
 
-	printf(
-		"rhombi_purgeDuplicates(): tilingId=%" PRIi8 ",  rhNumMax=%li,  before numRhombi=%li; ",
-		tlngP->tilingId,
-		tlngP->rhombi_NumMax,
-		tlngP->numFats + tlngP->numThins
-	);  // Erroneously, a fflush() here seems to generates extra newline.
-
 	for (numUniques = rhId1 = 0  ;  rhId1 < numRhombi  ;  rhId1++)  // numRhombi, not Fats+Thins, so sure to reach end despite duplicates being pruned.
 	{
+#if ExactCoordinates
+		// Duplicates have bit-identical centres, so are adjacent in the sort: only the latest unique need be compared.
+		rhId2 = numUniques - 1;
+		isUnique = ( rhId2 < 0  ||  ! lattice_same(
+			lattice_add( rhombus_northExact(&(tlngP->rhombi[rhId1])),  rhombus_southExact(&(tlngP->rhombi[rhId1])) ),
+			lattice_add( rhombus_northExact(&(tlngP->rhombi[rhId2])),  rhombus_southExact(&(tlngP->rhombi[rhId2])) )
+		) );
+#else
 		isUnique = true ;
 		for( rhId2 = numUniques - 1  ;  rhId2 >= 0  ;  rhId2-- )
 		{
-			if(     ( tlngP->rhombi[rhId1].centre.y - tlngP->rhombi[rhId2].centre.y )  >  thresholdSame )  break;  // Because sorted by y, know no matches
-			if( fabs( tlngP->rhombi[rhId1].centre.x - tlngP->rhombi[rhId2].centre.x )  >  thresholdSame )  continue;
+			if(     ( rhombus_hotCentre(tlngP, rhId1).y - rhombus_hotCentre(tlngP, rhId2).y )  >  thresholdSame )  break;  // Because sorted by y, know no matches
+			if( fabs( rhombus_hotCentre(tlngP, rhId1).x - rhombus_hotCentre(tlngP, rhId2).x )  >  thresholdSame )  continue;
 			isUnique = false;  // know this is a match
 			break;
 		}  // for rhId2
+#endif
 
 		if( isUnique )
 		{
 			if( numUniques < rhId1 )
+			{
 				tlngP->rhombi[numUniques] = tlngP->rhombi[rhId1] ;
+				hotArrays_move(tlngP,  numUniques,  rhId1);
+			}
 			numUniques++;
 		} else {
 			if( Fat == tlngP->rhombi[rhId1].physique )
@@ -58,9 +76,97 @@ void rhombi_purgeDuplicates(Tiling * const tlngP)
 		}
 	}  // for rhId1
 
+	return numUniques;
+}  // rhombi_purgeDuplicates_sorted()
+
+
+// One pass, no sort: each rhombus is looked up, by its centre, in a SpatialHash of the uniques so far.
+// Of a set of duplicates, that kept is the first by rhombiGt_ByY(), as would be kept by rhombi_purgeDuplicates_sorted().
+// Order otherwise unchanged. Returns the number of uniques.
+static long int rhombi_purgeDuplicates_hashed(Tiling * const tlngP)
+{
+	RhombId        rhId1, rhId2;
+	long int       numUniques = 0,  numCandidates,  candidateNum;
+	long int       candidates[8];
+	bool           isUnique;
+	double const   thresholdSame = tlngP->edgeLength * 0.01 ;  // As rhombi_purgeDuplicates_sorted()
+	long int const numRhombi = tlngP->numFats + tlngP->numThins;
+	SpatialHash    sh;
+
+	spatialHash_init(&sh,  2 * thresholdSame,  numRhombi);  // Pitch twice threshold, so the 2x2 cells of spatialHash_candidates() suffice.
+
+	for (numUniques = rhId1 = 0  ;  rhId1 < numRhombi  ;  rhId1++)
+	{
+		isUnique = true ;
+		numCandidates = spatialHash_candidates(&sh,  rhombus_hotCentre(tlngP, rhId1),  candidates,  8);
+		for( candidateNum = 0  ;  candidateNum < numCandidates  &&  candidateNum < 8  ;  candidateNum ++ )
+		{
+			rhId2 = candidates[candidateNum];
+#if ExactCoordinates
+			if( ! lattice_same(
+				lattice_add( rhombus_northExact(&(tlngP->rhombi[rhId1])),  rhombus_southExact(&(tlngP->rhombi[rhId1])) ),
+				lattice_add( rhombus_northExact(&(tlngP->rhombi[rhId2])),  rhombus_southExact(&(tlngP->rhombi[rhId2])) )
+			) )
+				continue;
+#else
+			if( fabs( rhombus_hotCentre(tlngP, rhId1).y - rhombus_hotCentre(tlngP, rhId2).y )  >  thresholdSame
+			||  fabs( rhombus_hotCentre(tlngP, rhId1).x - rhombus_hotCentre(tlngP, rhId2).x )  >  thresholdSame )
+				continue;
+#endif
+			isUnique = false;  // know this is a match
+			if( centresGt_ByY( rhombus_hotCentre(tlngP, rhId1),  rhombus_hotCentre(tlngP, rhId2) ) < 0 )
+			{
+				tlngP->rhombi[rhId2] = tlngP->rhombi[rhId1] ;  // Keep the same one as the sorted version would.
+				hotArrays_move(tlngP,  rhId2,  rhId1);
+			}
+			break;
+		}  // for( candidateNum ... )
+
+		if( isUnique )
+		{
+			if( numUniques < rhId1 )
+			{
+				tlngP->rhombi[numUniques] = tlngP->rhombi[rhId1] ;
+				hotArrays_move(tlngP,  numUniques,  rhId1);
+			}
+			spatialHash_insert(&sh,  rhombus_hotCentre(tlngP, numUniques),  numUniques);
+			numUniques++;
+		} else {
+			if( Fat == tlngP->rhombi[rhId1].physique )
+				(tlngP->numFats)--;
+			else
+				(tlngP->numThins)--;
+		}
+	}  // for rhId1
+
+	spatialHash_free(&sh);
+	return numUniques;
+}  // rhombi_purgeDuplicates_hashed()
+
+
+void rhombi_purgeDuplicates(Tiling * const tlngP)
+{
+	RhombId  rhId;
+	long int numUniques;
+
+	if( tlngP->numFats < 2  &&  tlngP->numThins < 2 )
+		return;
+
+	printf(
+		"rhombi_purgeDuplicates(): tilingId=%" PRIi8 ",  rhNumMax=%li,  before numRhombi=%li; ",
+		tlngP->tilingId,
+		tlngP->rhombi_NumMax,
+		tlngP->numFats + tlngP->numThins
+	);  // Erroneously, a fflush() here seems to generates extra newline.
+
+	if( purgeDuplicatesByHashQ(tlngP) )
+		numUniques = rhombi_purgeDuplicates_hashed(tlngP);
+	else
+		numUniques = rhombi_purgeDuplicates_sorted(tlngP);
+
 	printf("after numUniques=%li\n", numUniques);  fflush(stdout);
 
 	// Renumber remaining rhombi
-	for (rhId1 = 0  ;  rhId1 < tlngP->numFats + tlngP->numThins  ;  rhId1 ++)
-		tlngP->rhombi[rhId1].rhId = rhId1 ;
+	for (rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId ++)
+		tlngP->rhombi[rhId].rhId = rhId ;
 }  // rhombi_purgeDuplicates()
@@ -0,0 +1,64 @@
+// By and copyright Julian D. A. Wiseman of www.jdawiseman.com, April 2025
+// Released under GNU General Public License, Version 3, https://www.gnu.org/licenses/gpl-3.0.txt
+// regionOfInterest.c, in PenroseC
+
+#include "penrose.h"
+
+/*
+	If roi_polygon(), in controls.c, returns a polygon, which tiling_descendant() copies into roi_vertices, an ancestor is expanded
+	only if its descendants, at this and all later tilingIds, might come within roi_margin() of that polygon. Those descendants are all within RoiHull_EdgeLengths of the ancestor's
+	edge length from its centre: half the long diagonal, 0.951 edges for a thin, plus the repeated overhang of children straddling
+	edges, a geometric series summing to about 1.55 edges (measured from how much the whole tiling grows beyond its first rhombi).
+	That is about 2.5 edges; RoiHull_EdgeLengths is 3, the extra half edge being a safety margin against that measured estimate.
+	So the work and memory scale with the area of the polygon plus margin, rather than with the whole tiling.
+	Near the edge of the kept region, the tiling is ragged, and holesFill() and paths are not as they would be in a whole tiling.
+	Hence roi_margin(), which should be several edge lengths of the last tiling, and more if long paths are wanted complete.
+	A 'polygon' of one vertex is a point, as used by locate.c.
+*/
+
+#define RoiHull_EdgeLengths 3.0
+
+
+// Distance from point p to the polygon, zero if inside. Inside by the even-odd rule, so a self-intersecting polygon is as drawn.
+// With one vertex, the distance to that point.
+static double roi_distance(XY const p,  XY const * const vertices,  long int const numVertices)
+{
+	long int i, j;
+	bool inside = false;
+	double dist2Min = DBL_MAX,  dist2,  dx,  dy,  t;
+	XY a, b;
+
+	for( i = 0, j = numVertices - 1  ;  i < numVertices  ;  j = i++ )
+	{
+		a = vertices[j];
+		b = vertices[i];
+		if( (a.y > p.y) != (b.y > p.y)  &&  p.x < a.x + (p.y - a.y) * (b.x - a.x) / (b.y - a.y) )
+			inside = ! inside;
+
+		dx = b.x - a.x;
+		dy = b.y - a.y;
+		t = ( dx * dx + dy * dy > 0  ?  ((p.x - a.x) * dx + (p.y - a.y) * dy) / (dx * dx + dy * dy)  :  0 );
+		if( t < 0 )  t = 0;
+		if( t > 1 )  t = 1;
+		dist2 = pow(a.x + t * dx - p.x,  2)  +  pow(a.y + t * dy - p.y,  2);
+		if( dist2Min > dist2 )
+			dist2Min = dist2;
+	}  // for( i ... )
+
+	return( inside ? 0 : sqrt(dist2Min) );
+}  // roi_distance()
+
+
+// Whether any descendant of rhAncestorP, one of the rhombi of tlngAncestorP, the ancestor of tlngDescendantP, might be in or near the region of interest.
+bool rhombus_inRegionOfInterest(Tiling const * const tlngDescendantP,  Tiling const * const tlngAncestorP,  Rhombus const * const rhAncestorP)
+{
+	double const edgeLengthAncestor = tlngDescendantP->edgeLength * GoldenRatio;
+
+	if( tlngDescendantP->roi_numVertices < 1  ||  NULL == tlngDescendantP->roi_vertices )
+		return true;  // No region of interest, so everything is of interest.
+
+	return(
+		roi_distance(rhombus_centre(tlngAncestorP, rhAncestorP),  tlngDescendantP->roi_vertices,  tlngDescendantP->roi_numVertices)
+		<=  RoiHull_EdgeLengths * edgeLengthAncestor  +  tlngDescendantP->roi_marginDistance
+	);
+}  // rhombus_inRegionOfInterest()
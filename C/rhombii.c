@@ -4,29 +4,200 @@
 
 #include "penrose.h"
 
-RhombId rhombus_append(
-	Tiling * const tlngP,  Physique const physique,  int8_t filledType,
-	double const xNorth,  double const yNorth,  double const xSouth,  double const ySouth
-)
+// Changes rhombi_NumMax, keeping the rhombi and their rhIds. Pointers into rhombi[] are invalidated.
+void rhombi_resize(Tiling * const tlngP,  long int rhombi_NumMaxNew)
 {
-	if (! rhombus_keep(tlngP,  physique,  xNorth,  yNorth,  xSouth,  ySouth) )
-		return -1;
+	if( rhombi_NumMaxNew < tlngP->numFats + tlngP->numThins )
+		rhombi_NumMaxNew = tlngP->numFats + tlngP->numThins;
+	if( rhombi_NumMaxNew > RhombId_NumMax )
+		rhombi_NumMaxNew = RhombId_NumMax;
+	if( rhombi_NumMaxNew == tlngP->rhombi_NumMax )
+		return;
 
-	RhombId const rhId = tlngP->numFats + tlngP->numThins ;
-	int8_t nghbrNum;
+	tlngP->rhombi = bigArray_resize(tlngP,  tlngP->rhombi,  tlngP->rhombi_NumMax,  rhombi_NumMaxNew,  sizeof(Rhombus),  "rhombi",  &(tlngP->rhombi_Mapped));
+	if( NULL == tlngP->rhombi )
+	{
+		fprintf(stderr,
+			"!!! Error in rhombi_resize() with tilingId=%" PRIi8 ", numFats=%li, numThins=%li: could not resize rhombi_NumMax from %li to %li.\n",
+			tlngP->tilingId,  tlngP->numFats,  tlngP->numThins,  tlngP->rhombi_NumMax,  rhombi_NumMaxNew
+		);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+	tlngP->rhombi_NumMax = rhombi_NumMaxNew;
+}  // rhombi_resize()
 
-	if( rhId >= tlngP->rhombi_NumMax )
+
+// Makes space for at least one more rhombus, growing rhombi[] by a quarter if full.
+void rhombi_reserveOne(Tiling * const tlngP)
+{
+	if( tlngP->numFats + tlngP->numThins < tlngP->rhombi_NumMax )
+		return;
+
+	rhombi_resize(tlngP,  tlngP->rhombi_NumMax  +  tlngP->rhombi_NumMax / 4  +  64);
+	if( tlngP->numFats + tlngP->numThins >= tlngP->rhombi_NumMax )
 	{
 		fprintf(stderr,
-			"!!! Error in rhombus_append() with tilingId=%" PRIi8 ", numFats=%li, numThins=%li: rhombi_NumMax = %li is too small.\n",
+			"!!! Error in rhombi_reserveOne() with tilingId=%" PRIi8 ", numFats=%li, numThins=%li: rhombi_NumMax = %li cannot grow: set CompactRhombi and CompactNeighbours to false.\n",
 			tlngP->tilingId,  tlngP->numFats,  tlngP->numThins,  tlngP->rhombi_NumMax
 		);
 		fflush(stderr);
 		exit(EXIT_FAILURE);
 	}
+}  // rhombi_reserveOne()
+
+
+// First part of appending a rhombus: space, and rhId.
+static Rhombus * rhombus_append_start(Tiling * const tlngP)
+{
+	RhombId const rhId = tlngP->numFats + tlngP->numThins ;
+
+	rhombi_reserveOne(tlngP);
 
 	Rhombus * const rhP = &(tlngP->rhombi[rhId]) ;
-	rhP->rhId       = rhId;
+	rhP->rhId = rhId;
+	return rhP;
+}  // rhombus_append_start()
+
+
+// Counts a just-appended rhombus, whose hot entries are set (unless rhombi_Scratch), into its tiling, widening the tiling's bounding box.
+void rhombus_append_count(Tiling * const tlngP,  Rhombus const * const rhP)
+{
+	RhombId const rhId = rhP->rhId;
+
+	if( tlngP->rhombi_Scratch )
+		;  // No hot arrays, so no bounding box: the tiling's is widened as the rhombus is copied out of the buffer.
+	else if( 0 == tlngP->numFats + tlngP->numThins )
+	{
+		tlngP->xMax = rhombus_hotBBox(tlngP, rhId, xMax);
+		tlngP->yMax = rhombus_hotBBox(tlngP, rhId, yMax);
+		tlngP->xMin = rhombus_hotBBox(tlngP, rhId, xMin);
+		tlngP->yMin = rhombus_hotBBox(tlngP, rhId, yMin);
+	}
+	else
+	{
+		if(tlngP->xMax < rhombus_hotBBox(tlngP, rhId, xMax)) {tlngP->xMax = rhombus_hotBBox(tlngP, rhId, xMax);}
+		if(tlngP->yMax < rhombus_hotBBox(tlngP, rhId, yMax)) {tlngP->yMax = rhombus_hotBBox(tlngP, rhId, yMax);}
+		if(tlngP->xMin > rhombus_hotBBox(tlngP, rhId, xMin)) {tlngP->xMin = rhombus_hotBBox(tlngP, rhId, xMin);}
+		if(tlngP->yMin > rhombus_hotBBox(tlngP, rhId, yMin)) {tlngP->yMin = rhombus_hotBBox(tlngP, rhId, yMin);}
+	}
+
+	if( Fat == rhP->physique)
+		tlngP->numFats ++ ;
+	else
+		tlngP->numThins ++ ;
+}  // rhombus_append_count()
+
+
+// Copy one already-made rhombus, typically from a rhombi_Scratch buffer, to the end of tlngP, as rhombus_append() would have made it.
+void rhombus_append_copy(Tiling * const tlngP,  Rhombus const * const rhSourceP)
+{
+	RhombId const rhId = tlngP->numFats + tlngP->numThins ;
+
+	rhombi_reserveOne(tlngP);
+	Rhombus * const rhP = &(tlngP->rhombi[rhId]) ;
+	*rhP = *rhSourceP;
+	rhP->rhId = rhId;
+#if HotArrays
+	hotArrays_set(tlngP,  rhId);
+#endif
+	rhombus_append_count(tlngP,  rhP);
+}  // rhombus_append_copy()
+
+
+// Symmetric in north and south, so duplicates have identical centres.
+XY rhombus_derivedCentre(Tiling const * const tlngP,  Rhombus const * const rhP)
+{
+	XY const north = rhombus_north(tlngP, rhP);
+	XY const south = rhombus_south(tlngP, rhP);
+	XY centre;
+#if ! CompactRhombi
+	(void)tlngP;  // Read only by the CompactRhombi rhombus_north() etc., which derive vertices.
+#endif
+	centre.x = (north.x + south.x) / 2;
+	centre.y = (north.y + south.y) / 2;
+	return centre;
+}  // rhombus_derivedCentre()
+
+
+BBox rhombus_derivedBBox(Tiling const * const tlngP,  Rhombus const * const rhP)
+{
+	XY const north = rhombus_north(tlngP, rhP);
+	XY const south = rhombus_south(tlngP, rhP);
+	XY const east  = rhombus_east(tlngP, rhP);
+	XY const west  = rhombus_west(tlngP, rhP);
+	BBox bbox;
+#if ! CompactRhombi
+	(void)tlngP;  // Read only by the CompactRhombi rhombus_north() etc., which derive vertices.
+#endif
+	bbox.xMin = min_4(north.x, south.x, east.x, west.x);
+	bbox.xMax = max_4(north.x, south.x, east.x, west.x);
+	bbox.yMin = min_4(north.y, south.y, east.y, west.y);
+	bbox.yMax = max_4(north.y, south.y, east.y, west.y);
+	return bbox;
+}  // rhombus_derivedBBox()
+
+
+// Angle of the north-south diagonal, in [-90, 270).
+double rhombus_derivedAngleDegrees(XY const north,  XY const south)
+{
+	double angleDegrees = DegreesPerRadian * atan2(north.y - south.y,  north.x - south.x);
+	while(angleDegrees <  -90)  {angleDegrees += 360;}
+	while(angleDegrees >= 270)  {angleDegrees -= 360;}
+	return angleDegrees;
+}  // rhombus_derivedAngleDegrees()
+
+
+// Last part of appending a rhombus, after its vertices have been set.
+static RhombId rhombus_append_finish(Tiling * const tlngP,  Rhombus * const rhP)
+{
+	int8_t nghbrNum;
+	RhombId const rhId = rhP->rhId;
+
+#if ! CompactRhombi
+	rhP->angleDegrees = rhombus_derivedAngleDegrees(rhP->north,  rhP->south);
+#endif
+
+#if HotArrays
+	if( ! tlngP->rhombi_Scratch )
+		hotArrays_set(tlngP,  rhId);
+#elif ! CompactRhombi
+	BBox const bbox = rhombus_derivedBBox(tlngP, rhP);
+	rhP->centre = rhombus_derivedCentre(tlngP, rhP);
+	rhP->xMin = bbox.xMin;
+	rhP->xMax = bbox.xMax;
+	rhP->yMin = bbox.yMin;
+	rhP->yMax = bbox.yMax;
+#endif
+
+	rhP->numNeighbours = 0;
+	for( nghbrNum = 0  ;  nghbrNum < 4  ;  nghbrNum ++ )
+	{
+		rhP->neighbours[nghbrNum].rhId = -1;  // I.e., invalid
+		neighbour_nghbrsNghbrNum_set(rhP,  nghbrNum,  -1);  // I.e., invalid
+	}  // for( nghbrNum ... )
+	rhP->pathId               = -1;  // I.e., invalid
+	rhP->withinPathNum        = -1;  // I.e., invalid
+	rhP->pathId_ShortestOuter = -1;  // I.e., invalid
+	rhP->rhId_PathNext        = -1;  // I.e., invalid
+	rhP->rhId_PathPrev        = -1;  // I.e., invalid
+	rhP->wantedPostScript = false;
+
+	rhombus_append_count(tlngP,  rhP);
+	return rhId ;
+}  // rhombus_append_finish()
+
+
+#if ! CompactRhombi  // Which holds only exact vertices, so appends only by rhombus_append_exact().
+RhombId rhombus_append(
+	Tiling * const tlngP,  Physique const physique,  int8_t filledType,
+	double const xNorth,  double const yNorth,  double const xSouth,  double const ySouth
+)
+{
+	if (! rhombus_keep(tlngP,  physique,  xNorth,  yNorth,  xSouth,  ySouth) )
+		return -1;
+
+	Rhombus * const rhP = rhombus_append_start(tlngP);
 	rhP->physique   = physique;
 	rhP->filledType = filledType;
 	rhP->north.x    = xNorth;
@@ -34,12 +205,8 @@ RhombId rhombus_append(
 	rhP->south.x    = xSouth;
 	rhP->south.y    = ySouth;
 
-	rhP->centre.x   = rhP->east.x = rhP->west.x = (xNorth + xSouth) / 2;
-	rhP->centre.y   = rhP->east.y = rhP->west.y = (yNorth + ySouth) / 2;
-
-	rhP->angleDegrees = DegreesPerRadian * atan2(yNorth - ySouth, xNorth - xSouth);
-	while(rhP->angleDegrees <  -90)  {rhP->angleDegrees += 360;}
-	while(rhP->angleDegrees >= 270)  {rhP->angleDegrees -= 360;}
+	rhP->east.x     = rhP->west.x = (xNorth + xSouth) / 2;
+	rhP->east.y     = rhP->west.y = (yNorth + ySouth) / 2;
 
 	double const otherDiagonalFactor = (Fat == physique  ?  HalfRoot5Minus2Sqrt5  :  HalfRoot5Plus2Sqrt5);  // 0.36327 or 1.5388
 
@@ -48,151 +215,297 @@ RhombId rhombus_append(
 	rhP->east.y  -=  ( (xNorth - xSouth)  *  otherDiagonalFactor );
 	rhP->west.y  +=  ( (xNorth - xSouth)  *  otherDiagonalFactor );
 
-	rhP->xMax = max_4(rhP->north.x, rhP->south.x, rhP->east.x, rhP->west.x);
-	rhP->yMax = max_4(rhP->north.y, rhP->south.y, rhP->east.y, rhP->west.y);
-	rhP->xMin = min_4(rhP->north.x, rhP->south.x, rhP->east.x, rhP->west.x);
-	rhP->yMin = min_4(rhP->north.y, rhP->south.y, rhP->east.y, rhP->west.y);
+	return rhombus_append_finish(tlngP,  rhP);
+}  // rhombus_append()
+#endif  // ! CompactRhombi
 
-	rhP->numNeighbours = 0;
-	for( nghbrNum = 0  ;  nghbrNum < 4  ;  nghbrNum ++ )
-	{
-		rhP->neighbours[nghbrNum].rhId           = -1;  // I.e., invalid
-		rhP->neighbours[nghbrNum].pathId         = -1;  // I.e., invalid
-		rhP->neighbours[nghbrNum].withinPathNum  = -1;  // I.e., invalid
-		rhP->neighbours[nghbrNum].nghbrsNghbrNum = -1;  // I.e., invalid
-	}  // for( nghbrNum ... )
-	rhP->pathId               = -1;  // I.e., invalid
-	rhP->withinPathNum        = -1;  // I.e., invalid
-	rhP->pathId_ShortestOuter = -1;  // I.e., invalid
-	rhP->wantedPostScript = false;
 
-	if( 0 == tlngP->numFats + tlngP->numThins )
-	{
-		tlngP->xMax = rhP->xMax;
-		tlngP->yMax = rhP->yMax;
-		tlngP->xMin = rhP->xMin;
-		tlngP->yMin = rhP->yMin;
-	}
-	else
+#if ExactCoordinates
+RhombId rhombus_append_exact(
+	Tiling * const tlngP,  Physique const physique,  int8_t filledType,
+	Lattice const north,  Lattice const south
+)
+{
+	XY const xyNorth = lattice_xy(tlngP, north);
+	XY const xySouth = lattice_xy(tlngP, south);
+	int8_t const halfAngleSteps = (Fat == physique ? 1 : 2);  // Angle at north is 72 or 144 degrees, being 2 or 4 steps of 36.
+	Lattice const northToSouth = lattice_subtract(south, north);
+	int8_t direction;
+
+	if (! rhombus_keep(tlngP,  physique,  xyNorth.x,  xyNorth.y,  xySouth.x,  xySouth.y) )
+		return -1;
+
+	for( direction = 0  ;  direction < 10  ;  direction ++ )
+		if( lattice_same(northToSouth,  lattice_add( lattice_unit(direction - halfAngleSteps),  lattice_unit(direction + halfAngleSteps) )) )
+			break;
+	if( direction >= 10 )
 	{
-		if(tlngP->xMax < rhP->xMax) {tlngP->xMax = rhP->xMax;}
-		if(tlngP->yMax < rhP->yMax) {tlngP->yMax = rhP->yMax;}
-		if(tlngP->xMin > rhP->xMin) {tlngP->xMin = rhP->xMin;}
-		if(tlngP->yMin > rhP->yMin) {tlngP->yMin = rhP->yMin;}
-	}
+		fprintf(stderr,
+			"!!! Error in rhombus_append_exact() with tilingId=%" PRIi8 ": north=(%" PRIi32 ",%" PRIi32 ",%" PRIi32 ",%" PRIi32 ") and south=(%" PRIi32 ",%" PRIi32 ",%" PRIi32 ",%" PRIi32 ") not diagonal of a %s. !!!\n",
+			tlngP->tilingId,
+			north.a[0], north.a[1], north.a[2], north.a[3],  south.a[0], south.a[1], south.a[2], south.a[3],
+			Fat == physique ? "fat" : "thin"
+		);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}  // if( direction >= 10 )
 
-	if( Fat == physique)
-		tlngP->numFats ++ ;
-	else
-		tlngP->numThins ++ ;
+	Rhombus * const rhP = rhombus_append_start(tlngP);
+	rhP->physique       = physique;
+	rhP->filledType     = filledType;
+	rhP->directionExact = direction;
+	rhP->northExact     = north;
+#if ! CompactRhombi  // Else derived from the above by rhombus_southExact(), rhombus_south(), etc.
+	rhP->southExact     = south;
+	rhP->eastExact      = lattice_add(north,  lattice_unit(direction + halfAngleSteps));
+	rhP->westExact      = lattice_add(north,  lattice_unit(direction - halfAngleSteps));
 
-	return rhId ;
-}  // rhombus_append()
+	rhP->north    = xyNorth;
+	rhP->south    = xySouth;
+	rhP->east     = lattice_xy(tlngP,  rhP->eastExact);
+	rhP->west     = lattice_xy(tlngP,  rhP->westExact);
+#endif
 
+	return rhombus_append_finish(tlngP,  rhP);
+}  // rhombus_append_exact()
 
-void rhombus_append_descendants(Tiling *tlngP, Rhombus* rhP)
+
+typedef struct {Physique physique;  Lattice north;  Lattice south;} ChildExact;
+
+// Children relative to parent's north, in the descendant's basis, if the parent's directionExact were 0.
+// Same order as the non-exact code below.
+static ChildExact const childrenExact_Fat[5] = {
+	{Fat ,  {{ 0,  0, -1, -1}},  {{ 0,  0,  0,  0}}},
+	{Fat ,  {{ 1,  0, -1, -1}},  {{ 0, -1, -1, -1}}},
+	{Fat ,  {{ 1,  0, -1, -1}},  {{ 1,  1,  0,  0}}},
+	{Thin,  {{ 0,  0, -1,  0}},  {{ 0, -1, -1, -1}}},
+	{Thin,  {{ 0,  0,  0, -1}},  {{ 1,  1,  0,  0}}}
+};
+static ChildExact const childrenExact_Thin[4] = {
+	{Fat ,  {{ 1,  0,  0,  0}},  {{ 0, -1, -1,  0}}},
+	{Fat ,  {{ 1,  0,  0,  0}},  {{ 1,  1,  1,  0}}},
+	{Thin,  {{ 1,  0,  0,  1}},  {{ 0,  0,  0,  0}}},
+	{Thin,  {{ 1,  0,  1,  0}},  {{ 0,  0,  0,  0}}}
+};
+#endif  // ExactCoordinates
+
+
+// Which edge of the ancestor, if any, each child straddles. Same order as rhombus_append_descendants().
+// A straddling child is also made by the neighbour across that edge.
+typedef struct {bool onEdge;  bool touchesN;  bool touchesE;} ChildEdge;
+static ChildEdge const childEdges_Fat[5] = {
+	{false,  false,  false},  // Wholly within
+	{true ,  false,  false},  // South-west
+	{true ,  false,  true },  // South-east
+	{true ,  true ,  false},  // North-west
+	{true ,  true ,  true }   // North-east
+};
+static ChildEdge const childEdges_Thin[4] = {
+	{true ,  false,  false},
+	{true ,  false,  true },
+	{true ,  true ,  false},
+	{true ,  true ,  true }
+};
+
+
+// Whether rhP, of tlngAncestorP, makes its child childNum. If byEdgeOwnership, a child straddling an edge is made only
+// by the ancestor owning that edge: that with the lower rhId, or the only one if at the tiling's boundary. But if the
+// lower is outside the region of interest, so making no children, the edge is owned by the other, lest the child be lost.
+static bool rhombus_makesChild(
+	Tiling  const * const tlngDescendantP,
+	Tiling  const * const tlngAncestorP,
+	Rhombus const * const rhP,
+	bool            const byEdgeOwnership,
+	int8_t          const childNum
+)
+{
+	ChildEdge const * const edgeP = (Fat == rhP->physique ? childEdges_Fat : childEdges_Thin) + childNum;
+	int8_t nghbrNum;
+	RhombId rhId_Nghbr;
+
+	if( ! byEdgeOwnership  ||  ! edgeP->onEdge )
+		return true;
+
+	for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum ++ )
+		if( rhP->neighbours[nghbrNum].touchesN == edgeP->touchesN  &&  rhP->neighbours[nghbrNum].touchesE == edgeP->touchesE )
+		{
+			rhId_Nghbr = rhP->neighbours[nghbrNum].rhId;
+			return( rhP->rhId < rhId_Nghbr  ||  ! rhombus_inRegionOfInterest(tlngDescendantP,  tlngAncestorP,  tlngAncestorP->rhombi + rhId_Nghbr) );
+		}  // Neighbour on this edge
+
+	return true;  // No neighbour on this edge
+}  // rhombus_makesChild()
+
+
+// Number of children that rhombus_append_descendants() will try to make, before rhombus_keep().
+int8_t rhombus_numDescendants(Tiling const * const tlngDescendantP,  Tiling const * const tlngAncestorP,  Rhombus const * const rhP,  bool const byEdgeOwnership)
+{
+	int8_t const numChildren = (Fat == rhP->physique ? 5 : 4);
+	int8_t childNum, numMade = 0;
+
+	for( childNum = 0  ;  childNum < numChildren  ;  childNum ++ )
+		if( rhombus_makesChild(tlngDescendantP,  tlngAncestorP,  rhP,  byEdgeOwnership,  childNum) )
+			numMade ++;
+	return numMade;
+}  // rhombus_numDescendants()
+
+
+// The child of a rhombus of this physique that straddles the edge with these vertices.
+int8_t rhombus_childOnEdge(Physique const physique,  bool const touchesN,  bool const touchesE)
 {
+	ChildEdge const * const childEdges = (Fat == physique ? childEdges_Fat : childEdges_Thin);
+	int8_t const numChildren           = (Fat == physique ? 5 : 4);
+	int8_t childNum;
+
+	for( childNum = 0  ;  childNum < numChildren  ;  childNum ++ )
+		if( childEdges[childNum].onEdge  &&  childEdges[childNum].touchesN == touchesN  &&  childEdges[childNum].touchesE == touchesE )
+			return childNum;
+	return -1;  // Redundant
+}  // rhombus_childOnEdge()
+
+
+// rhP is of tlngAncestorP, which is used only if byEdgeOwnership.
+// If childRhIds is not NULL, childRhIds[childNum] is set to the rhId of the child, or -1 if not made here.
+void rhombus_append_descendants(Tiling *tlngP, Tiling const * const tlngAncestorP, Rhombus* rhP, bool const byEdgeOwnership, RhombId * const childRhIds)
+{
+	RhombId rhIds_Scratch[5];
+	RhombId * const rhIds = (NULL != childRhIds ? childRhIds : rhIds_Scratch);
+	int8_t  rhIdNum;
+
+	for( rhIdNum = 0  ;  rhIdNum < 5  ;  rhIdNum ++ )
+		rhIds[rhIdNum] = -1;
+
+	if( ! rhombus_inRegionOfInterest(tlngP,  tlngAncestorP,  rhP) )
+		return;  // No descendant could be near the region of interest.
+
+#if ExactCoordinates
+	Lattice const parentNorth = lattice_timesGoldenRatio(rhP->northExact);  // In the descendant's basis
+	ChildExact const * const children = (Fat == rhP->physique ? childrenExact_Fat : childrenExact_Thin);
+	int8_t const numChildren          = (Fat == rhP->physique ? 5 : 4);
+	int8_t childNum;
+
+	for( childNum = 0  ;  childNum < numChildren  ;  childNum ++ )
+		if( rhombus_makesChild(tlngP,  tlngAncestorP,  rhP,  byEdgeOwnership,  childNum) )
+			rhIds[childNum] = rhombus_append_exact(
+				tlngP,
+				children[childNum].physique,
+				0,  // not filled hole
+				lattice_add( parentNorth,  lattice_rotate(children[childNum].north, rhP->directionExact) ),
+				lattice_add( parentNorth,  lattice_rotate(children[childNum].south, rhP->directionExact) )
+			);
+#else
 	double const xNorthMinusSouth = rhP->north.x - rhP->south.x;
 	double const yNorthMinusSouth = rhP->north.y - rhP->south.y;
+	XY     const centre           = rhombus_centre(tlngAncestorP, rhP);
 
 	if(Fat == rhP->physique)
 	{
 		// Fat
 
-		rhombus_append(
-			tlngP,
-			Fat,
-			0,  // not filled hole
-			rhP->south.x * GoldenRatioReciprocal  +  rhP->north.x * Half3MinusSqrt5,
-			rhP->south.y * GoldenRatioReciprocal  +  rhP->north.y * Half3MinusSqrt5,
-			rhP->north.x,
-			rhP->north.y
-		);
+		if( rhombus_makesChild(tlngP,  tlngAncestorP,  rhP,  byEdgeOwnership,  0) )
+			rhIds[0] = rhombus_append(
+				tlngP,
+				Fat,
+				0,  // not filled hole
+				rhP->south.x * GoldenRatioReciprocal  +  rhP->north.x * Half3MinusSqrt5,
+				rhP->south.y * GoldenRatioReciprocal  +  rhP->north.y * Half3MinusSqrt5,
+				rhP->north.x,
+				rhP->north.y
+			);
 
-		rhombus_append(
-			tlngP,
-			Fat,
-			0,  // not filled hole
-			rhP->south.x,
-			rhP->south.y,
-			rhP->centre.x  -  yNorthMinusSouth * HalfRoot5Minus2Sqrt5,
-			rhP->centre.y  +  xNorthMinusSouth * HalfRoot5Minus2Sqrt5
-		);
+		if( rhombus_makesChild(tlngP,  tlngAncestorP,  rhP,  byEdgeOwnership,  1) )
+			rhIds[1] = rhombus_append(
+				tlngP,
+				Fat,
+				0,  // not filled hole
+				rhP->south.x,
+				rhP->south.y,
+				centre.x  -  yNorthMinusSouth * HalfRoot5Minus2Sqrt5,
+				centre.y  +  xNorthMinusSouth * HalfRoot5Minus2Sqrt5
+			);
 
-		rhombus_append(
-			tlngP,
-			Fat,
-			0,  // not filled hole
-			rhP->south.x,
-			rhP->south.y,
-			rhP->centre.x  +  yNorthMinusSouth * HalfRoot5Minus2Sqrt5,
-			rhP->centre.y  -  xNorthMinusSouth * HalfRoot5Minus2Sqrt5
-		);
+		if( rhombus_makesChild(tlngP,  tlngAncestorP,  rhP,  byEdgeOwnership,  2) )
+			rhIds[2] = rhombus_append(
+				tlngP,
+				Fat,
+				0,  // not filled hole
+				rhP->south.x,
+				rhP->south.y,
+				centre.x  +  yNorthMinusSouth * HalfRoot5Minus2Sqrt5,
+				centre.y  -  xNorthMinusSouth * HalfRoot5Minus2Sqrt5
+			);
 
-		rhombus_append(
-			tlngP,
-			Thin,
-			false,  // not filled hole
-			rhP->north.x * Quarter5MinusSqrt5  +  rhP->south.x * Cos72  -  yNorthMinusSouth * QuarterRoot50Minus22Sqrt5,
-			rhP->north.y * Quarter5MinusSqrt5  +  rhP->south.y * Cos72  +  xNorthMinusSouth * QuarterRoot50Minus22Sqrt5,
-			rhP->centre.x  -  yNorthMinusSouth * HalfRoot5Minus2Sqrt5,
-			rhP->centre.y  +  xNorthMinusSouth * HalfRoot5Minus2Sqrt5
-		);
+		if( rhombus_makesChild(tlngP,  tlngAncestorP,  rhP,  byEdgeOwnership,  3) )
+			rhIds[3] = rhombus_append(
+				tlngP,
+				Thin,
+				false,  // not filled hole
+				rhP->north.x * Quarter5MinusSqrt5  +  rhP->south.x * Cos72  -  yNorthMinusSouth * QuarterRoot50Minus22Sqrt5,
+				rhP->north.y * Quarter5MinusSqrt5  +  rhP->south.y * Cos72  +  xNorthMinusSouth * QuarterRoot50Minus22Sqrt5,
+				centre.x  -  yNorthMinusSouth * HalfRoot5Minus2Sqrt5,
+				centre.y  +  xNorthMinusSouth * HalfRoot5Minus2Sqrt5
+			);
 
-		rhombus_append(
-			tlngP,
-			Thin,
-			0,  // not filled hole
-			rhP->north.x * Quarter5MinusSqrt5  +  rhP->south.x * Cos72  +  yNorthMinusSouth * QuarterRoot50Minus22Sqrt5,
-			rhP->north.y * Quarter5MinusSqrt5  +  rhP->south.y * Cos72  -  xNorthMinusSouth * QuarterRoot50Minus22Sqrt5,
-			rhP->centre.x  +  yNorthMinusSouth * HalfRoot5Minus2Sqrt5,
-			rhP->centre.y  -  xNorthMinusSouth * HalfRoot5Minus2Sqrt5
-		);
+		if( rhombus_makesChild(tlngP,  tlngAncestorP,  rhP,  byEdgeOwnership,  4) )
+			rhIds[4] = rhombus_append(
+				tlngP,
+				Thin,
+				0,  // not filled hole
+				rhP->north.x * Quarter5MinusSqrt5  +  rhP->south.x * Cos72  +  yNorthMinusSouth * QuarterRoot50Minus22Sqrt5,
+				rhP->north.y * Quarter5MinusSqrt5  +  rhP->south.y * Cos72  -  xNorthMinusSouth * QuarterRoot50Minus22Sqrt5,
+				centre.x  +  yNorthMinusSouth * HalfRoot5Minus2Sqrt5,
+				centre.y  -  xNorthMinusSouth * HalfRoot5Minus2Sqrt5
+			);
 
 	}  // Fat
 	else
 	{
 		// Thin
 
-		rhombus_append(
-			tlngP,
-			Fat,
-			0,  // not filled hole
-			rhP->south.x,
-			rhP->south.y,
-			rhP->centre.x  -  yNorthMinusSouth * HalfRoot5Plus2Sqrt5,
-			rhP->centre.y  +  xNorthMinusSouth * HalfRoot5Plus2Sqrt5
-		);
+		if( rhombus_makesChild(tlngP,  tlngAncestorP,  rhP,  byEdgeOwnership,  0) )
+			rhIds[0] = rhombus_append(
+				tlngP,
+				Fat,
+				0,  // not filled hole
+				rhP->south.x,
+				rhP->south.y,
+				centre.x  -  yNorthMinusSouth * HalfRoot5Plus2Sqrt5,
+				centre.y  +  xNorthMinusSouth * HalfRoot5Plus2Sqrt5
+			);
 
-		rhombus_append(
-			tlngP,
-			Fat,
-			0,  // not filled hole
-			rhP->south.x,
-			rhP->south.y,
-			rhP->centre.x  +  yNorthMinusSouth * HalfRoot5Plus2Sqrt5,
-			rhP->centre.y  -  xNorthMinusSouth * HalfRoot5Plus2Sqrt5
-		);
+		if( rhombus_makesChild(tlngP,  tlngAncestorP,  rhP,  byEdgeOwnership,  1) )
+			rhIds[1] = rhombus_append(
+				tlngP,
+				Fat,
+				0,  // not filled hole
+				rhP->south.x,
+				rhP->south.y,
+				centre.x  +  yNorthMinusSouth * HalfRoot5Plus2Sqrt5,
+				centre.y  -  xNorthMinusSouth * HalfRoot5Plus2Sqrt5
+			);
 
-		rhombus_append(
-			tlngP,
-			Thin,
-			0,  // not filled hole
-			rhP->north.x * Cos36  +  rhP->south.x * Quarter3MinusSqrt5  -  yNorthMinusSouth * Sin36,
-			rhP->north.y * Cos36  +  rhP->south.y * Quarter3MinusSqrt5  +  xNorthMinusSouth * Sin36,
-			rhP->north.x,
-			rhP->north.y
-		);
+		if( rhombus_makesChild(tlngP,  tlngAncestorP,  rhP,  byEdgeOwnership,  2) )
+			rhIds[2] = rhombus_append(
+				tlngP,
+				Thin,
+				0,  // not filled hole
+				rhP->north.x * Cos36  +  rhP->south.x * Quarter3MinusSqrt5  -  yNorthMinusSouth * Sin36,
+				rhP->north.y * Cos36  +  rhP->south.y * Quarter3MinusSqrt5  +  xNorthMinusSouth * Sin36,
+				rhP->north.x,
+				rhP->north.y
+			);
 
-		rhombus_append(
-			tlngP,
-			Thin,
-			0,  // not filled hole
-			rhP->north.x * Cos36  +  rhP->south.x * Quarter3MinusSqrt5  +  yNorthMinusSouth * Sin36,
-			rhP->north.y * Cos36  +  rhP->south.y * Quarter3MinusSqrt5  -  xNorthMinusSouth * Sin36,
-			rhP->north.x,
-			rhP->north.y
-		);
+		if( rhombus_makesChild(tlngP,  tlngAncestorP,  rhP,  byEdgeOwnership,  3) )
+			rhIds[3] = rhombus_append(
+				tlngP,
+				Thin,
+				0,  // not filled hole
+				rhP->north.x * Cos36  +  rhP->south.x * Quarter3MinusSqrt5  +  yNorthMinusSouth * Sin36,
+				rhP->north.y * Cos36  +  rhP->south.y * Quarter3MinusSqrt5  -  xNorthMinusSouth * Sin36,
+				rhP->north.x,
+				rhP->north.y
+			);
 
 	}  // Thin
+#endif  // ExactCoordinates
 }  // rhombus_append_descendants()
@@ -13,6 +13,15 @@ extern double min_4(double const d0, double const d1, double const d2, double co
 
 
 
+// Elapsed real time, in seconds from an arbitrary origin. Unlike clock(), not summed over threads.
+extern double wallClockSeconds(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC,  &ts);
+	return ts.tv_sec  +  ts.tv_nsec / 1e9;
+}  // wallClockSeconds()
+
+
 extern double avg_2(double const d0, double const d1)
 {
 	return (d0 == d1)  ?  d0  :  (d0 + d1)/2;  // Precision fussiness
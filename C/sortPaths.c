@@ -22,17 +22,51 @@ int pathGt_ByClosedEtc(
 }  // pathGt_ByClosedEtc()
 
 
+// Keys for radix_permutation(), giving the same order as pathGt_ByClosedEtc().
+static uint64_t paths_radixKey_ByClosedEtc(void const * const context,  long int const idx,  int8_t const keyNum)
+{
+	Path const * const pathP = (Path const *)context + idx;
+	switch(keyNum)
+	{
+	case 0:
+		return( pathP->pathClosed ? 0 : 1 );  // Closed paths earlier
+	case 1:
+		return ~radix_keyLong(pathP->pathLength);  // Longer paths earlier
+	case 2:
+		return( pathP->pathClosed  &&  5 == pathP->pathLength  &&  ! pathP->pointy ? 1 : 0 );
+	case 3:
+		return radix_keyDouble(pathP->centre.y);  // Lower path Ys earlier
+	default:
+		return radix_keyDouble(pathP->centre.x);  // Left paths earlier
+	}  // switch(keyNum)
+}  // paths_radixKey_ByClosedEtc()
+
+
 void paths_sort(Tiling * const tlngP,  int orderedFn(const Path * const, const Path * const) )
 {
 	PathId     pathId, *pathIdsNew;
 	PathStatId pathStatId;
 	RhombId    rhId_This;
-	int8_t     nghbrNum;
 
 	for( pathId = 0  ;  pathId < tlngP->numPathsClosed + tlngP->numPathsOpen  ;  pathId++ )
 		tlngP->path[pathId].pathId = pathId;
 
-	qsort( tlngP->path,  tlngP->numPathsClosed + tlngP->numPathsOpen,  sizeof (tlngP->path[0]),  (int(*)(const void * const,const void * const)) orderedFn );
+	if( sortByRadixQ(tlngP)  &&  &pathGt_ByClosedEtc == orderedFn )
+	{
+		long int const numPaths = tlngP->numPathsClosed + tlngP->numPathsOpen;
+		long int * const perm = malloc( (numPaths > 0 ? numPaths : 1)  *  sizeof(long int) );
+		if( NULL == perm )
+		{
+			fprintf(stderr, "Error in paths_sort: malloc(...) == NULL for perm;  numPaths = %li.", numPaths );
+			fflush(stderr);
+			exit(EXIT_FAILURE) ;
+		}  // NULL == perm
+		radix_permutation(numPaths,  5,  &paths_radixKey_ByClosedEtc,  tlngP->path,  perm);
+		radix_permutationApply(tlngP->path,  numPaths,  sizeof(Path),  perm);
+		free(perm);
+	}  // radix
+	else
+		qsort( tlngP->path,  tlngP->numPathsClosed + tlngP->numPathsOpen,  sizeof (tlngP->path[0]),  (int(*)(const void * const,const void * const)) orderedFn );
 
 	pathIdsNew = malloc( (tlngP->numPathsClosed + tlngP->numPathsOpen)  *  sizeof(PathId) );
 	if( pathIdsNew == NULL )
@@ -57,9 +91,6 @@ void paths_sort(Tiling * const tlngP,  int orderedFn(const Path * const, const P
 			if( tlngP->rhombi[rhId_This].pathId_ShortestOuter >= 0 )
 				tlngP->rhombi[rhId_This].pathId_ShortestOuter = pathIdsNew[ tlngP->rhombi[rhId_This].pathId_ShortestOuter ];
 		}  // Thin
-		for( nghbrNum = 0  ;  nghbrNum < tlngP->rhombi[rhId_This].numNeighbours  ;  nghbrNum++ )
-			if( tlngP->rhombi[rhId_This].neighbours[nghbrNum].pathId >= 0 )
-				tlngP->rhombi[rhId_This].neighbours[nghbrNum].pathId = pathIdsNew[ tlngP->rhombi[rhId_This].neighbours[nghbrNum].pathId ];
 	}  // for( rhId_This ... )
 
 	for( pathId = 0  ;  pathId < tlngP->numPathsClosed + tlngP->numPathsOpen  ;  pathId++ )
@@ -0,0 +1,148 @@
+// By and copyright Julian D. A. Wiseman of www.jdawiseman.com, April 2025
+// Released under GNU General Public License, Version 3, https://www.gnu.org/licenses/gpl-3.0.txt
+// sortRadix.c, in PenroseC
+
+#include "penrose.h"
+
+/*
+	Sorting by radix rather than by qsort(), as chosen by sortByRadixQ().
+	An ordering is expressed as a few 64-bit keys per element, compared as unsigned integers, most significant first.
+	radix_permutation() finds the order with a stable LSD radix sort of (key, index) pairs, 16 bits per pass, so a few
+	linear passes per key, with no comparator calls and without moving the big structs. radix_permutationApply() then
+	moves each struct once. Doubles are keyed exactly, by radix_keyDouble(), so the order is that of the comparator.
+*/
+
+#define RadixBits 16
+#define RadixNumBuckets (1L << RadixBits)
+
+typedef struct {uint64_t key;  long int idx;} RadixPair;
+
+
+// Order-preserving: if d0 < d1 then radix_keyDouble(d0) < radix_keyDouble(d1). -0 and +0 have the same key.
+uint64_t radix_keyDouble(double d)
+{
+	uint64_t u;
+	d += 0.0;  // -0 becomes +0
+	memcpy(&u, &d, sizeof(u));
+	return ( (u >> 63)  ?  ~u  :  (u | ((uint64_t)1 << 63)) );
+}  // radix_keyDouble()
+
+
+uint64_t radix_keyLong(long int const i)
+{
+	return (uint64_t)i ^ ((uint64_t)1 << 63);
+}  // radix_keyLong()
+
+
+// Sets perm[] such that element perm[0] is first, perm[1] second, etc. Stable: elements with all keys equal stay in index order.
+void radix_permutation(
+	long int   const n,
+	int8_t     const numKeys,
+	uint64_t         keyFn(void const * const context,  long int const idx,  int8_t const keyNum),  // keyNum 0 most significant.
+	void const     * context,
+	long int * const perm
+)
+{
+	RadixPair *pairs, *pairsOther, *pairsSwap;
+	long int  *counts;
+	long int i, bucket, total, count;
+	int8_t keyNum, shift;
+	uint64_t keyOr, keyAnd;
+
+	for( i = 0  ;  i < n  ;  i++ )
+		perm[i] = i;
+	if( n < 2 )
+		return;
+
+	pairs      = malloc( n * sizeof(RadixPair) );
+	pairsOther = malloc( n * sizeof(RadixPair) );
+	counts     = malloc( RadixNumBuckets * sizeof(long int) );
+	if( NULL == pairs  ||  NULL == pairsOther  ||  NULL == counts )
+	{
+		fprintf(stderr, "radix_permutation(): !!! malloc() failure, n=%li !!!\n", n);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+
+	for( keyNum = numKeys - 1  ;  keyNum >= 0  ;  keyNum-- )  // Least significant first
+	{
+		keyOr  = 0;
+		keyAnd = ~(uint64_t)0;
+		for( i = 0  ;  i < n  ;  i++ )
+		{
+			pairs[i].idx = perm[i];
+			pairs[i].key = keyFn(context, perm[i], keyNum);
+			keyOr  |= pairs[i].key;
+			keyAnd &= pairs[i].key;
+		}  // for( i ... )
+
+		for( shift = 0  ;  shift < 64  ;  shift += RadixBits )
+		{
+			if( 0 == ( ((keyOr ^ keyAnd) >> shift) & (RadixNumBuckets - 1) ) )
+				continue;  // All have the same digit, so this pass would change nothing.
+
+			memset(counts, 0, RadixNumBuckets * sizeof(long int));
+			for( i = 0  ;  i < n  ;  i++ )
+				counts[ (pairs[i].key >> shift) & (RadixNumBuckets - 1) ] ++;
+			for( bucket = total = 0  ;  bucket < RadixNumBuckets  ;  bucket++ )
+			{
+				count = counts[bucket];
+				counts[bucket] = total;
+				total += count;
+			}  // for( bucket ... )
+			for( i = 0  ;  i < n  ;  i++ )
+				pairsOther[ counts[ (pairs[i].key >> shift) & (RadixNumBuckets - 1) ] ++ ] = pairs[i];
+
+			pairsSwap = pairs;  pairs = pairsOther;  pairsOther = pairsSwap;
+		}  // for( shift ... )
+
+		for( i = 0  ;  i < n  ;  i++ )
+			perm[i] = pairs[i].idx;
+	}  // for( keyNum ... )
+
+	free(counts);
+	free(pairsOther);
+	free(pairs);
+}  // radix_permutation()
+
+
+// Reorders base[], of n elements each of numBytes, such that the new base[i] is the old base[perm[i]]. Each moved once.
+// perm[] is used as scratch, being left as the identity.
+void radix_permutationApply(
+	void     * const base,
+	long int   const n,
+	size_t     const numBytes,
+	long int * const perm
+)
+{
+	char * const b = (char *)base;
+	char * const tmp = malloc(numBytes);
+	long int i, j, k;
+
+	if( NULL == tmp )
+	{
+		fprintf(stderr, "radix_permutationApply(): !!! malloc() failure, numBytes=%li !!!\n", (long int)numBytes);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+
+	for( i = 0  ;  i < n  ;  i++ )
+	{
+		if( perm[i] == i )
+			continue;
+		memcpy(tmp,  b + i * numBytes,  numBytes);
+		for( j = i  ;  ;  j = k )  // Follow the cycle
+		{
+			k = perm[j];
+			perm[j] = j;
+			if( k == i )
+			{
+				memcpy(b + j * numBytes,  tmp,  numBytes);
+				break;
+			}
+			memcpy(b + j * numBytes,  b + k * numBytes,  numBytes);
+		}  // for( j ... )
+	}  // for( i ... )
+
+	free(tmp);
+}  // radix_permutationApply()
@@ -4,11 +4,17 @@
 
 #include "penrose.h"
 
+// As rhombiGt_ByY(), if CompactRhombi only by radix, so never called.
 int rhombiGt_ByPath(
 	Rhombus const * const rhP0,
 	Rhombus const * const rhP1
 )
 {
+#if CompactRhombi
+	fprintf(stderr, "Error in rhombiGt_ByPath: with CompactRhombi, rhombi can be ordered only by radix.\n");
+	fflush(stderr);
+	exit(EXIT_FAILURE);
+#endif
 	if( rhP0->physique != rhP1->physique )
 		return ( Fat == rhP0->physique ? -1 : +1 );  // Fats first.
 
@@ -23,44 +29,111 @@ int rhombiGt_ByPath(
 		break;  // Entirely redundant.
 
 	case Thin:
-		if( rhP0->centre.y < rhP1->centre.y )  return +1 ;  // Higher thin rhombus Ys earlier
-		if( rhP0->centre.y > rhP1->centre.y )  return -1 ;  // Lower thin rhombus Ys later
-		if( rhP0->centre.x > rhP1->centre.x )  return +1 ;  // Left thin rhombus earlier
-		if( rhP0->centre.x < rhP1->centre.x )  return -1 ;  // Right thin rhombus later
+	{
+		XY const centre0 = rhombus_centre(NULL, rhP0);  // No tiling, as above.
+		XY const centre1 = rhombus_centre(NULL, rhP1);
+		if( centre0.y < centre1.y )  return +1 ;  // Higher thin rhombus Ys earlier
+		if( centre0.y > centre1.y )  return -1 ;  // Lower thin rhombus Ys later
+		if( centre0.x > centre1.x )  return +1 ;  // Left thin rhombus earlier
+		if( centre0.x < centre1.x )  return -1 ;  // Right thin rhombus later
 		return 0;  // rhP0 == rhP1
 		break;  // Entirely redundant.
+	}  // Thin
 	}  // switch(rhP0->physique)
 }  // rhombiGt_ByPath()
 
 
-int neighbourGt(Neighbour const * const nP0,  Neighbour const * const nP1)
+// Keys for radix_permutation(), giving the same order as rhombiGt_ByY(). The context is the Tiling.
+static uint64_t rhombi_radixKey_ByY(void const * const context,  long int const idx,  int8_t const keyNum)
 {
-	if( nP0->physique != nP1->physique )
-		return ( Fat == nP1->physique ? +1 : -1 ) ;
+	Tiling const * const tlngP = (Tiling const *)context;
+	return radix_keyDouble( 0 == keyNum  ?  rhombus_hotCentre(tlngP, idx).y  :  rhombus_hotCentre(tlngP, idx).x );
+}  // rhombi_radixKey_ByY()
+
 
-	switch( nP0->physique )
+// Keys for radix_permutation(), giving the same order as rhombiGt_ByPath(). The context is the Tiling.
+static uint64_t rhombi_radixKey_ByPath(void const * const context,  long int const idx,  int8_t const keyNum)
+{
+	Tiling  const * const tlngP = (Tiling const *)context;
+	Rhombus const * const rhP   = tlngP->rhombi + idx;
+	switch(keyNum)
 	{
-	case Fat:  // ==> both Fat
-		if(nP0->pathId == nP1->pathId)
+	case 0:
+		return( Fat == rhP->physique ? 0 : 1 );
+	case 1:
+		return( Fat == rhP->physique ? radix_keyLong(rhP->pathId)         : ~radix_keyDouble(rhombus_hotCentre(tlngP, idx).y) );  // Thins: higher Ys earlier
+	default:
+		return( Fat == rhP->physique ? radix_keyLong(rhP->withinPathNum)  :  radix_keyDouble(rhombus_hotCentre(tlngP, idx).x) );
+	}  // switch(keyNum)
+}  // rhombi_radixKey_ByPath()
+
+
+// After the rhombi have been moved, each rhId field still being the old position, changes all the rhIds stored in rhombi and paths.
+static void rhombi_renumber(Tiling * const tlngP)
+{
+	RhombId        rhId;
+	PathId         pathId;
+	RhombId        *rhombIdsNew;
+	int8_t         nghbrNum;
+	Rhombus        *rhP;
+	Path           *pathP;
+	long int const numRhombi = tlngP->numFats + tlngP->numThins;
+
+	rhombIdsNew = malloc( numRhombi  *  sizeof(RhombId) );
+	if( rhombIdsNew == NULL )
+	{
+		fprintf(stderr, "Error in rhombi_renumber: malloc(...) == NULL;  numRhombi = %li;  sizeof(RhombId) = %li.", numRhombi, sizeof(RhombId) );
+		fflush(stderr);
+		exit(EXIT_FAILURE) ;
+	}  // rhombIdsNew == NULL
+
+	for( rhId = 0  ;  rhId < numRhombi  ;  rhId++ )
+		rhombIdsNew[rhId] = -1;
+
+	for( rhId = 0  ;  rhId < numRhombi  ;  rhId++ )
+		if( tlngP->rhombi[rhId].rhId >= 0 )
+			rhombIdsNew[ tlngP->rhombi[rhId].rhId ] = rhId;
+
+	for( pathId = 0  ;  pathId < tlngP->numPathsClosed + tlngP->numPathsOpen  ;  pathId++ )
+	{
+		pathP = &(tlngP->path[pathId]);
+		pathP->rhId_ThinWithin_First = numRhombi - 1;
+		pathP->rhId_ThinWithin_Last  = 0;
+		if( tlngP->path[pathId].pathClosed )
 		{
-			if( nP1->withinPathNum == 0 )  return +1 ;
-			if( nP0->withinPathNum == 0 )  return -1 ;
-			return( nP0->withinPathNum < nP1->withinPathNum ? +1 : -1 );
-		}
-		else
+			pathP->rhId_PathCentreClosest  = rhombIdsNew[ pathP->rhId_PathCentreClosest  ];
+			pathP->rhId_PathCentreFurthest = rhombIdsNew[ pathP->rhId_PathCentreFurthest ];
+			pathP->rhId_openPathEnd = -1;
+		}  // Closed
+		else  // Open
 		{
-			// Two Fat neighbours of a Thin; cannot be two Fat neighbours of a Fat.
-			return( nP0->pathId > nP1->pathId ? +1 : -1 );  // cannot be equal
-		}
-		break;  // Entirely redundant.
+			pathP->rhId_PathCentreClosest  = rhombIdsNew[ pathP->rhId_PathCentreClosest  ];  // For open, the path's start
+			pathP->rhId_openPathEnd = rhombIdsNew[ pathP->rhId_openPathEnd ];
+		}  // Open
+	}  // for( pathId ... )
 
-	case Thin:  // ==> both Thin
-		if( nP0->rhId < nP1->rhId )  return +1 ;
-		if( nP0->rhId > nP1->rhId )  return -1 ;
-		return 0 ;
-		break;  // Entirely redundant.
-	}  // switch( rhP0->physique )
-}  // neighbourGt()
+	if( NULL != tlngP->pathRhIds )
+		for( rhId = 0  ;  rhId < tlngP->numFats  ;  rhId++ )
+			tlngP->pathRhIds[rhId] = rhombIdsNew[ tlngP->pathRhIds[rhId] ];
+
+	for( rhId = 0  ;  rhId < numRhombi  ;  rhId++ )
+	{
+		rhP = &(tlngP->rhombi[rhId]);
+		rhP->rhId = rhId ;
+		for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum++ )
+			rhP->neighbours[nghbrNum].rhId = rhombIdsNew[ rhP->neighbours[nghbrNum].rhId ] ;
+		if( rhP->rhId_PathNext >= 0 )  {rhP->rhId_PathNext = rhombIdsNew[ rhP->rhId_PathNext ];}
+		if( rhP->rhId_PathPrev >= 0 )  {rhP->rhId_PathPrev = rhombIdsNew[ rhP->rhId_PathPrev ];}
+		if( Thin == rhP->physique  &&  rhP->pathId_ShortestOuter >= 0 )
+		{
+			pathP = &(tlngP->path[ rhP->pathId_ShortestOuter ]);
+			if( pathP->rhId_ThinWithin_First > rhId )  {pathP->rhId_ThinWithin_First = rhId;}
+			if( pathP->rhId_ThinWithin_Last  < rhId )  {pathP->rhId_ThinWithin_Last  = rhId;}
+		}  // Thin ...
+	}  // for( rhId ... )
+
+	free(rhombIdsNew);
+}  // rhombi_renumber()
 
 
 void rhombi_sort(
@@ -70,74 +143,40 @@ void rhombi_sort(
 )
 {
 	RhombId        rhId;
-	PathId         pathId;
-	RhombId        *rhombIdsNew;
-	int8_t         nghbrNum;
-	Rhombus        *rhP;
-	Path           *pathP;
 	long int const numRhombi = tlngP->numFats + tlngP->numThins;
 
+	tlngP->rhombi_Spatial = false;
 	if( alsoRenumber )
 		for( rhId = 0  ;  rhId < numRhombi  ;  rhId++ )
 			tlngP->rhombi[rhId].rhId = rhId;
 
-	qsort(
-		tlngP->rhombi,
-		numRhombi,
-		sizeof(Rhombus),
-		( int(*)(const void * const,const void * const) ) orderedFn
-	);  // qsort()
-
-	if( alsoRenumber )
+	if( (CompactRhombi  ||  sortByRadixQ(tlngP))  &&  (&rhombiGt_ByY == orderedFn  ||  &rhombiGt_ByPath == orderedFn) )
 	{
-		rhombIdsNew = malloc( numRhombi  *  sizeof(RhombId) );
-		if( rhombIdsNew == NULL )
+		long int * const perm = malloc( (numRhombi > 0 ? numRhombi : 1)  *  sizeof(long int) );
+		if( NULL == perm )
 		{
-			fprintf(stderr, "Error in rhombi_sort: malloc(...) == NULL;  numRhombi = %li;  sizeof(RhombId) = %li.", numRhombi, sizeof(RhombId) );
+			fprintf(stderr, "Error in rhombi_sort: malloc(...) == NULL for perm;  numRhombi = %li.", numRhombi );
 			fflush(stderr);
 			exit(EXIT_FAILURE) ;
-		}  // rhombIdsNew == NULL
-
-		for( rhId = 0  ;  rhId < numRhombi  ;  rhId++ )
-			rhombIdsNew[rhId] = -1;
-
-		for( rhId = 0  ;  rhId < numRhombi  ;  rhId++ )
-			if( tlngP->rhombi[rhId].rhId >= 0 )
-				rhombIdsNew[ tlngP->rhombi[rhId].rhId ] = rhId;
-
-		for( pathId = 0  ;  pathId < tlngP->numPathsClosed + tlngP->numPathsOpen  ;  pathId++ )
-		{
-			pathP = &(tlngP->path[pathId]);
-			pathP->rhId_ThinWithin_First = numRhombi - 1;
-			pathP->rhId_ThinWithin_Last  = 0;
-			if( tlngP->path[pathId].pathClosed )
-			{
-				pathP->rhId_PathCentreClosest  = rhombIdsNew[ pathP->rhId_PathCentreClosest  ];
-				pathP->rhId_PathCentreFurthest = rhombIdsNew[ pathP->rhId_PathCentreFurthest ];
-				pathP->rhId_openPathEnd = -1;
-			}  // Closed
-			else  // Open
-				pathP->rhId_openPathEnd = rhombIdsNew[ pathP->rhId_openPathEnd ];
-		}  // for( pathId ... )
+		}  // NULL == perm
+		if( &rhombiGt_ByY == orderedFn )
+			radix_permutation(numRhombi,  2,  &rhombi_radixKey_ByY,     tlngP,  perm);
+		else
+			radix_permutation(numRhombi,  3,  &rhombi_radixKey_ByPath,  tlngP,  perm);
+		radix_permutationApply(tlngP->rhombi,  numRhombi,  sizeof(Rhombus),  perm);
+		free(perm);
+	}  // radix
+	else
+		qsort(
+			tlngP->rhombi,
+			numRhombi,
+			sizeof(Rhombus),
+			( int(*)(const void * const,const void * const) ) orderedFn
+		);  // qsort()
+	hotArrays_derive(tlngP,  0,  numRhombi);
 
-		for( rhId = 0  ;  rhId < numRhombi  ;  rhId++ )
-		{
-			rhP = &(tlngP->rhombi[rhId]);
-			rhP->rhId = rhId ;
-			for( nghbrNum = 0  ;  nghbrNum < rhP->numNeighbours  ;  nghbrNum++ )
-				rhP->neighbours[nghbrNum].rhId = rhombIdsNew[ rhP->neighbours[nghbrNum].rhId ] ;
-			if( Thin == rhP->physique  &&  rhP->pathId_ShortestOuter >= 0 )
-			{
-				pathP = &(tlngP->path[ rhP->pathId_ShortestOuter ]);
-				if( pathP->rhId_ThinWithin_First > rhId )  {pathP->rhId_ThinWithin_First = rhId;}
-				if( pathP->rhId_ThinWithin_Last  < rhId )  {pathP->rhId_ThinWithin_Last  = rhId;}
-			}  // Thin ...
-		}  // for( rhId ... )
-
-		free(rhombIdsNew);
-		rhombIdsNew = NULL;
-
-	}  // alsoRenumber
+	if( alsoRenumber )
+		rhombi_renumber(tlngP);
 	else
 	{
 		// alsoRenumber == false
@@ -146,3 +185,214 @@ void rhombi_sort(
 	}
 
 }  // rhombi_sort()
+
+
+typedef struct {Tiling const * tlngP;  RhombId numSorted;} TailContext;
+
+// Keys for radix_permutation() of the tail of rhombi_sortTail_ByY(), as rhombi_radixKey_ByY().
+static uint64_t rhombi_radixKey_ByY_Tail(void const * const context,  long int const idx,  int8_t const keyNum)
+{
+	TailContext const * const tcP = (TailContext const *)context;
+	return radix_keyDouble( 0 == keyNum  ?  rhombus_hotCentre(tcP->tlngP, tcP->numSorted + idx).y  :  rhombus_hotCentre(tcP->tlngP, tcP->numSorted + idx).x );
+}  // rhombi_radixKey_ByY_Tail()
+
+
+// For rhombi sorted by rhombiGt_ByY() but for a few appended, rhombi[numSorted] onwards, as after holesFill(): sorts only those,
+// merges them in, and renumbers. Same result as rhombi_sort(tlngP, &rhombiGt_ByY, true), but not O(n log n). If tailRhIdsNew is
+// not NULL, the new rhIds of the appended rhombi are put there, in some order. Returns false, having changed nothing, if the
+// rhombi before numSorted are not sorted and numbered, so the caller should use rhombi_sort().
+bool rhombi_sortTail_ByY(Tiling * const tlngP,  RhombId const numSorted,  RhombId * const tailRhIdsNew)
+{
+	RhombId        rhId,  rhId_Sorted,  tailNum;
+	long int const numRhombi = tlngP->numFats + tlngP->numThins;
+	long int const numTail   = numRhombi - numSorted;
+	TailContext const tc = {.tlngP = tlngP,  .numSorted = numSorted};
+	Rhombus      * tail;
+	XY           * tailCentres;
+	long int     * perm;
+
+	for( rhId = 0  ;  rhId < numSorted  ;  rhId++ )
+		if( tlngP->rhombi[rhId].rhId != rhId  ||  ( rhId > 0  &&  centresGt_ByY(rhombus_hotCentre(tlngP, rhId - 1),  rhombus_hotCentre(tlngP, rhId)) >= 0 ) )
+			return false;
+	if( numTail <= 0 )
+		return true;
+
+	tail        = malloc( numTail * sizeof(Rhombus) );
+	tailCentres = malloc( numTail * sizeof(XY) );
+	perm        = malloc( numTail * sizeof(long int) );
+	if( NULL == tail  ||  NULL == tailCentres  ||  NULL == perm )
+	{
+		fprintf(stderr, "Error in rhombi_sortTail_ByY: malloc(...) == NULL for tail;  numTail = %li.", numTail );
+		fflush(stderr);
+		exit(EXIT_FAILURE) ;
+	}  // NULL == tail
+	for( rhId = numSorted  ;  rhId < numRhombi  ;  rhId++ )
+		tlngP->rhombi[rhId].rhId = rhId;
+
+	// The tail in order by radix, with its centres, as the merge below overwrites the tail's place in rhombi[] and the hot arrays.
+	radix_permutation(numTail,  2,  &rhombi_radixKey_ByY_Tail,  &tc,  perm);
+	for( tailNum = 0  ;  tailNum < numTail  ;  tailNum++ )
+	{
+		tail[tailNum]        = tlngP->rhombi[ numSorted + perm[tailNum] ];
+		tailCentres[tailNum] = rhombus_hotCentre(tlngP,  numSorted + perm[tailNum]);
+	}  // for( tailNum ... )
+	free(perm);
+
+	// Merge from the end, so each rhombus of the prefix moves at most once, and those before the first of the tail not at all.
+	// The prefix's centres are read from places not yet overwritten, being before rhId.
+	rhId_Sorted = numSorted - 1;
+	for( tailNum = numTail - 1,  rhId = numRhombi - 1  ;  tailNum >= 0  ;  rhId-- )
+		if( rhId_Sorted >= 0  &&  centresGt_ByY(rhombus_hotCentre(tlngP, rhId_Sorted),  tailCentres[tailNum]) > 0 )
+			tlngP->rhombi[rhId] = tlngP->rhombi[rhId_Sorted--];
+		else
+		{
+			if( NULL != tailRhIdsNew )
+				tailRhIdsNew[tailNum] = rhId;
+			tlngP->rhombi[rhId] = tail[tailNum--];
+		}  // From tail
+	free(tail);
+	free(tailCentres);
+	hotArrays_derive(tlngP,  0,  numRhombi);
+
+	tlngP->rhombi_Spatial = false;
+	rhombi_renumber(tlngP);
+	return true;
+}  // rhombi_sortTail_ByY()
+
+
+// Spreads the 32 bits of u into the even bits of the result.
+static uint64_t mortonSpread(uint64_t u)
+{
+	u = (u | (u << 16)) & 0x0000FFFF0000FFFFULL;
+	u = (u | (u <<  8)) & 0x00FF00FF00FF00FFULL;
+	u = (u | (u <<  4)) & 0x0F0F0F0F0F0F0F0FULL;
+	u = (u | (u <<  2)) & 0x3333333333333333ULL;
+	u = (u | (u <<  1)) & 0x5555555555555555ULL;
+	return u;
+}  // mortonSpread()
+
+
+typedef struct {Tiling const * tlngP;  XY centreMin;  double scaleX,  scaleY;} MortonContext;
+
+// Keys for radix_permutation(): the Morton (Z-order) index of the centre, then y and x to make the order total.
+static uint64_t rhombi_radixKey_ByMorton(void const * const context,  long int const idx,  int8_t const keyNum)
+{
+	MortonContext const * const mcP = (MortonContext const *)context;
+	XY const centre = rhombus_hotCentre(mcP->tlngP, idx);
+	switch(keyNum)
+	{
+	case 0:
+		return(
+			 mortonSpread( (uint64_t)( (centre.x - mcP->centreMin.x) * mcP->scaleX ) )
+			| (mortonSpread( (uint64_t)( (centre.y - mcP->centreMin.y) * mcP->scaleY ) ) << 1)
+		);
+	case 1:
+		return radix_keyDouble(centre.y);
+	default:
+		return radix_keyDouble(centre.x);
+	}  // switch(keyNum)
+}  // rhombi_radixKey_ByMorton()
+
+
+// Sorts and renumbers the rhombi along a Z-order curve of their centres, so that rhombi near in the plane are mostly near in
+// memory, and following neighbours or paths mostly stays in cache. Unlike by y, for which rows are about sqrt(n) apart.
+void rhombi_sortSpatially(Tiling * const tlngP)
+{
+	RhombId        rhId;
+	MortonContext  mc;
+	XY             centreMax;
+	long int const numRhombi = tlngP->numFats + tlngP->numThins;
+	long int * const perm = malloc( (numRhombi > 0 ? numRhombi : 1)  *  sizeof(long int) );
+
+	if( NULL == perm )
+	{
+		fprintf(stderr, "Error in rhombi_sortSpatially: malloc(...) == NULL for perm;  numRhombi = %li.", numRhombi );
+		fflush(stderr);
+		exit(EXIT_FAILURE) ;
+	}  // NULL == perm
+
+	mc.tlngP = tlngP;
+	mc.centreMin.x = mc.centreMin.y = +DBL_MAX;
+	centreMax.x    = centreMax.y    = -DBL_MAX;
+	for( rhId = 0  ;  rhId < numRhombi  ;  rhId++ )
+	{
+		tlngP->rhombi[rhId].rhId = rhId;
+		if( mc.centreMin.x > rhombus_hotCentre(tlngP, rhId).x )  mc.centreMin.x = rhombus_hotCentre(tlngP, rhId).x;
+		if( mc.centreMin.y > rhombus_hotCentre(tlngP, rhId).y )  mc.centreMin.y = rhombus_hotCentre(tlngP, rhId).y;
+		if( centreMax.x    < rhombus_hotCentre(tlngP, rhId).x )  centreMax.x    = rhombus_hotCentre(tlngP, rhId).x;
+		if( centreMax.y    < rhombus_hotCentre(tlngP, rhId).y )  centreMax.y    = rhombus_hotCentre(tlngP, rhId).y;
+	}  // for( rhId ... )
+	mc.scaleX = (centreMax.x > mc.centreMin.x  ?  4294967295.0 / (centreMax.x - mc.centreMin.x)  :  0);  // Into 32 bits
+	mc.scaleY = (centreMax.y > mc.centreMin.y  ?  4294967295.0 / (centreMax.y - mc.centreMin.y)  :  0);
+
+	radix_permutation(numRhombi,  3,  &rhombi_radixKey_ByMorton,  &mc,  perm);
+	radix_permutationApply(tlngP->rhombi,  numRhombi,  sizeof(Rhombus),  perm);
+	free(perm);
+	hotArrays_derive(tlngP,  0,  numRhombi);
+
+	rhombi_renumber(tlngP);
+	tlngP->rhombi_Spatial = true;
+}  // rhombi_sortSpatially()
+
+
+// Makes a view of the rhombi in the order of orderedFn, which must be rhombiGt_ByY() or rhombiGt_ByPath(), without changing the tiling.
+// So the tiling can be exported in several orders without re-sorting and renumbering it for each.
+void rhombiOrder_make(
+	Tiling const * const tlngP,
+	int orderedFn(const Rhombus * const, const Rhombus * const),
+	RhombiOrder  * const orderP
+)
+{
+	long int const numRhombi = tlngP->numFats + tlngP->numThins;
+	long int const numPaths  = tlngP->numPathsClosed + tlngP->numPathsOpen;
+	Rhombus const * rhP;
+	PathId pathId;
+	long int k;
+
+	orderP->numRhombi        = numRhombi;
+	orderP->rhIds            = malloc( (numRhombi > 0 ? numRhombi : 1)  *  sizeof(RhombId) );
+	orderP->thinWithin_First = malloc( (numPaths  > 0 ? numPaths  : 1)  *  sizeof(RhombId) );
+	orderP->thinWithin_Last  = malloc( (numPaths  > 0 ? numPaths  : 1)  *  sizeof(RhombId) );
+	if( NULL == orderP->rhIds  ||  NULL == orderP->thinWithin_First  ||  NULL == orderP->thinWithin_Last )
+	{
+		fprintf(stderr, "Error in rhombiOrder_make: malloc(...) == NULL;  numRhombi = %li;  numPaths = %li.", numRhombi, numPaths );
+		fflush(stderr);
+		exit(EXIT_FAILURE) ;
+	}  // NULL == ...
+
+	if( &rhombiGt_ByY == orderedFn )
+		radix_permutation(numRhombi,  2,  &rhombi_radixKey_ByY,     tlngP,  orderP->rhIds);
+	else if( &rhombiGt_ByPath == orderedFn )
+		radix_permutation(numRhombi,  3,  &rhombi_radixKey_ByPath,  tlngP,  orderP->rhIds);
+	else
+	{
+		fprintf(stderr, "Error in rhombiOrder_make: orderedFn is neither rhombiGt_ByY nor rhombiGt_ByPath.");
+		fflush(stderr);
+		exit(EXIT_FAILURE) ;
+	}  // Unknown orderedFn
+
+	for( pathId = 0  ;  pathId < numPaths  ;  pathId++ )
+	{
+		orderP->thinWithin_First[pathId] = numRhombi - 1;
+		orderP->thinWithin_Last[ pathId] = 0;
+	}  // for( pathId ... )
+	for( k = 0  ;  k < numRhombi  ;  k++ )
+	{
+		rhP = &(tlngP->rhombi[ orderP->rhIds[k] ]);
+		if( Thin == rhP->physique  &&  rhP->pathId_ShortestOuter >= 0  &&  rhP->pathId_ShortestOuter < numPaths )  // Might be unset if paths not yet populated
+		{
+			pathId = rhP->pathId_ShortestOuter;
+			if( orderP->thinWithin_First[pathId] > k )  {orderP->thinWithin_First[pathId] = k;}
+			if( orderP->thinWithin_Last[ pathId] < k )  {orderP->thinWithin_Last[ pathId] = k;}
+		}  // Thin ...
+	}  // for( k ... )
+}  // rhombiOrder_make()
+
+
+void rhombiOrder_free(RhombiOrder * const orderP)
+{
+	free(orderP->rhIds);             orderP->rhIds            = NULL;
+	free(orderP->thinWithin_First);  orderP->thinWithin_First = NULL;
+	free(orderP->thinWithin_Last);   orderP->thinWithin_Last  = NULL;
+	orderP->numRhombi = 0;
+}  // rhombiOrder_free()
@@ -0,0 +1,140 @@
+// By and copyright Julian D. A. Wiseman of www.jdawiseman.com, April 2025
+// Released under GNU General Public License, Version 3, https://www.gnu.org/licenses/gpl-3.0.txt
+// spatialHash.c, in PenroseC
+
+#include "penrose.h"
+
+/*
+	A hash table from points to long int values, for finding which points are within a tolerance of another.
+	The plane is cut into square cells of side pitch; a point is stored under its cell.
+	Open addressing, linear probing. All entries of one cell start probing at the same slot, so all
+	are found before the first empty slot.
+	spatialHash_candidates() returns values in the 2x2 block of cells nearest to the point, which
+	contains every point within pitch/2 of it in both x and y. So tolerances should be < pitch/2.
+*/
+
+
+static inline void spatialHash_cell(SpatialHash const * const shP,  XY const xy,  int64_t * const cellXP,  int64_t * const cellYP)
+{
+	*cellXP = (int64_t)floor(xy.x / shP->pitch);
+	*cellYP = (int64_t)floor(xy.y / shP->pitch);
+}  // spatialHash_cell()
+
+
+static inline long int spatialHash_slotFirst(SpatialHash const * const shP,  int64_t const cellX,  int64_t const cellY)
+{
+	uint64_t h = (uint64_t)cellX * 0x9E3779B97F4A7C15ULL  ^  (uint64_t)cellY * 0xC2B2AE3D27D4EB4FULL;
+	h ^= h >> 29;
+	return (long int)(h & (uint64_t)(shP->numSlots - 1));
+}  // spatialHash_slotFirst()
+
+
+void spatialHash_init(SpatialHash * const shP,  double const pitch,  long int const numExpected)
+{
+	long int slotNum;
+
+	shP->pitch    = pitch;
+	shP->numUsed  = 0;
+	shP->numSlots = 1024;
+	while( shP->numSlots < 2 * numExpected )  // Load factor at most 1/2.
+		shP->numSlots *= 2;
+
+	shP->slots = malloc( shP->numSlots * sizeof(SpatialHashSlot) );
+	if( NULL == shP->slots )
+	{
+		fprintf(stderr, "spatialHash_init(): !!! NULL == slots, numSlots=%li !!!\n", shP->numSlots);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+	for( slotNum = 0  ;  slotNum < shP->numSlots  ;  slotNum ++ )
+		shP->slots[slotNum].value = -1;
+}  // spatialHash_init()
+
+
+void spatialHash_free(SpatialHash * const shP)
+{
+	if( NULL != shP->slots )
+		free(shP->slots);
+	shP->slots    = NULL;
+	shP->numSlots = 0;
+	shP->numUsed  = 0;
+}  // spatialHash_free()
+
+
+static void spatialHash_grow(SpatialHash * const shP)
+{
+	SpatialHashSlot * const slotsOld = shP->slots;
+	long int const numSlotsOld = shP->numSlots;
+	long int slotNum, slotNew;
+
+	shP->numSlots *= 2;
+	shP->slots = malloc( shP->numSlots * sizeof(SpatialHashSlot) );
+	if( NULL == shP->slots )
+	{
+		fprintf(stderr, "spatialHash_grow(): !!! NULL == slots, numSlots=%li !!!\n", shP->numSlots);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+	for( slotNum = 0  ;  slotNum < shP->numSlots  ;  slotNum ++ )
+		shP->slots[slotNum].value = -1;
+
+	for( slotNum = 0  ;  slotNum < numSlotsOld  ;  slotNum ++ )
+		if( slotsOld[slotNum].value >= 0 )
+		{
+			slotNew = spatialHash_slotFirst(shP,  slotsOld[slotNum].cellX,  slotsOld[slotNum].cellY);
+			while( shP->slots[slotNew].value >= 0 )
+				slotNew = (slotNew + 1) & (shP->numSlots - 1);
+			shP->slots[slotNew] = slotsOld[slotNum];
+		}  // if( used )
+
+	free(slotsOld);
+}  // spatialHash_grow()
+
+
+// value must be >= 0.
+void spatialHash_insert(SpatialHash * const shP,  XY const xy,  long int const value)
+{
+	int64_t cellX, cellY;
+	long int slotNum;
+
+	if( 2 * (shP->numUsed + 1) > shP->numSlots )
+		spatialHash_grow(shP);
+
+	spatialHash_cell(shP, xy, &cellX, &cellY);
+	slotNum = spatialHash_slotFirst(shP, cellX, cellY);
+	while( shP->slots[slotNum].value >= 0 )
+		slotNum = (slotNum + 1) & (shP->numSlots - 1);
+
+	shP->slots[slotNum].cellX = cellX;
+	shP->slots[slotNum].cellY = cellY;
+	shP->slots[slotNum].value = value;
+	shP->numUsed ++;
+}  // spatialHash_insert()
+
+
+// Writes to values[] up to maxNumValues values, of points in the 2x2 cells nearest xy. Returns the number found, which might exceed maxNumValues.
+long int spatialHash_candidates(SpatialHash const * const shP,  XY const xy,  long int * const values,  long int const maxNumValues)
+{
+	int64_t cellX, cellY, cellX_Other, cellY_Other, cellX_This, cellY_This;
+	long int slotNum, numFound = 0;
+	int8_t blockNum;
+
+	spatialHash_cell(shP, xy, &cellX, &cellY);
+	cellX_Other = cellX + ( xy.x / shP->pitch - cellX < 0.5  ?  -1  :  +1 );
+	cellY_Other = cellY + ( xy.y / shP->pitch - cellY < 0.5  ?  -1  :  +1 );
+
+	for( blockNum = 0  ;  blockNum < 4  ;  blockNum ++ )
+	{
+		cellX_This = (blockNum & 1  ?  cellX_Other  :  cellX);
+		cellY_This = (blockNum & 2  ?  cellY_Other  :  cellY);
+		for( slotNum = spatialHash_slotFirst(shP, cellX_This, cellY_This)  ;  shP->slots[slotNum].value >= 0  ;  slotNum = (slotNum + 1) & (shP->numSlots - 1) )
+			if( shP->slots[slotNum].cellX == cellX_This  &&  shP->slots[slotNum].cellY == cellY_This )
+			{
+				if( numFound < maxNumValues )
+					values[numFound] = shP->slots[slotNum].value;
+				numFound ++;
+			}  // if( same cell )
+	}  // for( blockNum ... )
+
+	return numFound;
+}  // spatialHash_candidates()
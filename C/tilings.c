@@ -4,8 +4,201 @@
 
 #include "penrose.h"
 
-static clock_t prevTime  = -1;
-static clock_t singleStartTime = -1;
+static double prevTime  = -1;
+static double singleStartTime = -1;  // Wall-clock, as wallClockSeconds(), so that threads are not summed.
+
+
+typedef struct  // DescendantsChunk
+{
+	Tiling          buffer;              // Scratch tiling, holding this chunk's children in ancestor order.
+	Tiling const  * tlngAncestorP;
+	RhombId         rhId_AncestorStart;
+	RhombId         rhId_AncestorEnd;    // Exclusive
+	bool            byEdgeOwnership;
+	RhombId       * childRhIds;          // NULL, or as rhombus_append_descendants(), initially local to buffer.
+	int8_t        * numChildren;         // Indexed by ancestor's rhId; shared between chunks, each writing only its own range.
+	RhombId         rhId_BufferNext;     // Cursor used while concatenating.
+} DescendantsChunk;
+
+
+// Thread body: a contiguous range of ancestors appends its descendants to the chunk's own buffer.
+static void * descendants_chunk_generate(void * const arg)
+{
+	DescendantsChunk * const chunkP = (DescendantsChunk *)arg;
+	RhombId rhId_Ancestor;
+	long int numBefore;
+
+	for( rhId_Ancestor = chunkP->rhId_AncestorStart  ;  rhId_Ancestor < chunkP->rhId_AncestorEnd  ;  rhId_Ancestor ++ )
+	{
+		numBefore = chunkP->buffer.numFats + chunkP->buffer.numThins;
+		rhombus_append_descendants(
+			&(chunkP->buffer),
+			chunkP->tlngAncestorP,
+			chunkP->tlngAncestorP->rhombi + rhId_Ancestor,
+			chunkP->byEdgeOwnership,
+			NULL == chunkP->childRhIds  ?  NULL  :  chunkP->childRhIds + 5 * rhId_Ancestor
+		);
+		chunkP->numChildren[rhId_Ancestor] = (int8_t)(chunkP->buffer.numFats + chunkP->buffer.numThins - numBefore);
+	}  // for( rhId_Ancestor ... )
+
+	return NULL;
+}  // descendants_chunk_generate()
+
+
+// Whether, before the next ancestor's children, the descendant is due a rhombi_purgeDuplicates(), as called by both the serial
+// and the parallel loops, so that the two purge at the same rhombi. Purpose: if huge memory assigned, best not to use it all as
+// that might entail copying to and from disk. An occasional purge of duplicates might lessen this. Also allows less memory to
+// have been malloc'd.
+static bool descendants_purgeDueQ(
+	Tiling const * const tlngDescendantP,
+	bool const byEdgeOwnership,
+	long int const numRhAtPreviousPurgeDuplicates
+)
+{
+	long int const numRhombi = tlngDescendantP->numFats + tlngDescendantP->numThins;
+
+	return  ! byEdgeOwnership  // No duplicates to purge.
+		&&  (   numRhombi >= numRhAtPreviousPurgeDuplicates + 14128176  // 4G of memory, being arbitrarily occasional.
+		    ||  (   numRhombi >= tlngDescendantP->rhombi_NumMax - 8     // Tight against boundary: purge duplicates rather than grow,
+		        &&  numRhombi >= numRhAtPreviousPurgeDuplicates + tlngDescendantP->rhombi_NumMax / 8 ) );  // unless a purge was recent, in which case rhombus_append() grows the array.
+}  // descendants_purgeDueQ()
+
+
+// Parallel equivalent of calling rhombus_append_descendants() for every ancestor, in order.
+// The ancestors are split into DescendantsChunksPerThread * numThreads contiguous chunks, done in waves of numThreads.
+// In a wave, each thread makes the children of one chunk into that chunk's own buffer, a calloc()'d rhombi_Scratch tiling
+// with no hot arrays. Then, serially and in ancestor order, the wave's buffers are copied into the descendant, with the
+// same occasional rhombi_purgeDuplicates() as the serial loop, and freed. So the descendant's array is, at every purge
+// and at the end, the same as made serially; hence the output is the same. And at most one wave is buffered, about
+// 1/DescendantsChunksPerThread of the gross children. Returns the number of calls of rhombi_purgeDuplicates(), and sets
+// *numThreadsP to the number of threads used, being fewer than asked if there are fewer ancestors.
+#define DescendantsChunksPerThread 16
+static long int descendants_append_parallel(
+	Tiling * const tlngDescendantP,
+	Tiling const * const tlngAncestorP,
+	int * const numThreadsP,
+	bool const byEdgeOwnership,
+	RhombId * const childRhIds
+)
+{
+	long int const numAncestors = tlngAncestorP->numFats + tlngAncestorP->numThins;
+	long int numRhAtPreviousPurgeDuplicates = 0;
+	long int numSpecialDeduplications = 0;
+	long int numChunks, chunkNum, waveStart, waveEnd;
+	int numThreads;
+	RhombId rhId_Ancestor, rhId_Child, rhId_ChunkStart;
+	int8_t childNum;
+	DescendantsChunk *chunks, *chunkP;
+	pthread_t *threads;
+	bool *threadStarted;
+	int8_t *numChildren;
+
+	if( *numThreadsP > numAncestors )
+		*numThreadsP = (int)numAncestors;
+	numThreads = *numThreadsP;
+	numChunks = (long int)numThreads * DescendantsChunksPerThread;
+	if( numChunks > numAncestors / 1024 )  // Not so small that the threads' start-up dominates.
+		numChunks = numAncestors / 1024;
+	if( numChunks < numThreads )
+		numChunks = numThreads;
+
+	chunks        = malloc( numThreads   * sizeof(DescendantsChunk) );
+	threads       = malloc( numThreads   * sizeof(pthread_t) );
+	threadStarted = malloc( numThreads   * sizeof(bool) );
+	numChildren   = malloc( numAncestors * sizeof(int8_t) );
+	if( NULL == chunks  ||  NULL == threads  ||  NULL == threadStarted  ||  NULL == numChildren )
+	{
+		fprintf(stderr, "descendants_append_parallel(): !!! malloc() failure, numThreads=%i, numAncestors=%li !!!\n", numThreads, numAncestors);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}
+
+	for( waveStart = 0  ;  waveStart < numChunks  ;  waveStart = waveEnd )
+	{
+		waveEnd = waveStart + numThreads;
+		if( waveEnd > numChunks )
+			waveEnd = numChunks;
+
+		for( chunkNum = waveStart  ;  chunkNum < waveEnd  ;  chunkNum ++ )
+		{
+			chunkP = &(chunks[chunkNum - waveStart]);
+			chunkP->tlngAncestorP      = tlngAncestorP;
+			chunkP->rhId_AncestorStart = (RhombId)( (numAncestors * (long long int)chunkNum      ) / numChunks );
+			chunkP->rhId_AncestorEnd   = (RhombId)( (numAncestors * (long long int)(chunkNum + 1)) / numChunks );
+			chunkP->byEdgeOwnership    = byEdgeOwnership;
+			chunkP->childRhIds         = childRhIds;
+			chunkP->numChildren        = numChildren;
+			chunkP->rhId_BufferNext    = 0;
+
+			chunkP->buffer = *tlngDescendantP;  // Copies tilingId, edgeLength, etc, as might be used by rhombus_keep().
+			chunkP->buffer.numFats  = 0;
+			chunkP->buffer.numThins = 0;
+			chunkP->buffer.rhombi_NumMax = 0;
+			chunkP->buffer.rhombi_Mapped = false;
+			chunkP->buffer.rhombi_Scratch = true;  // So no hot arrays, recomputed anyway by rhombus_append_copy(), and nothing mapped, so no clash of file names.
+#if HotArrays
+			chunkP->buffer.hot_NumMax = 0;
+			chunkP->buffer.hotCentres = NULL;
+			chunkP->buffer.hotBBoxes  = NULL;
+			chunkP->buffer.hotCentres_Mapped = false;
+			chunkP->buffer.hotBBoxes_Mapped  = false;
+#endif
+			for( rhId_Ancestor = chunkP->rhId_AncestorStart  ;  rhId_Ancestor < chunkP->rhId_AncestorEnd  ;  rhId_Ancestor ++ )
+				chunkP->buffer.rhombi_NumMax += rhombus_numDescendants( tlngDescendantP,  tlngAncestorP,  tlngAncestorP->rhombi + rhId_Ancestor,  byEdgeOwnership );
+			// calloc() not malloc(): rhombus_append() leaves some fields unset, later filled or not, so copies should be as from fresh memory.
+			chunkP->buffer.rhombi = calloc( (chunkP->buffer.rhombi_NumMax > 0 ? chunkP->buffer.rhombi_NumMax : 1),  sizeof(Rhombus) );
+			if( NULL == chunkP->buffer.rhombi )
+			{
+				fprintf(stderr, "descendants_append_parallel(): !!! NULL == buffer.rhombi, chunkNum=%li !!!\n", chunkNum);
+				fflush(stderr);
+				exit(EXIT_FAILURE);
+			}
+
+			threadStarted[chunkNum - waveStart] = ( 0 == pthread_create(&(threads[chunkNum - waveStart]), NULL, &descendants_chunk_generate, chunkP) );
+			if( ! threadStarted[chunkNum - waveStart] )
+				descendants_chunk_generate(chunkP);  // Couldn't start a thread, so do it here.
+		}  // for( chunkNum ... )
+
+		for( chunkNum = waveStart  ;  chunkNum < waveEnd  ;  chunkNum ++ )
+			if( threadStarted[chunkNum - waveStart] )
+				pthread_join(threads[chunkNum - waveStart], NULL);
+
+		// Concatenate, in ancestor order, purging exactly when the serial loop would.
+		for( chunkNum = waveStart  ;  chunkNum < waveEnd  ;  chunkNum ++ )
+		{
+			chunkP = &(chunks[chunkNum - waveStart]);
+			rhId_ChunkStart = tlngDescendantP->numFats + tlngDescendantP->numThins;
+			for( rhId_Ancestor = chunkP->rhId_AncestorStart  ;  rhId_Ancestor < chunkP->rhId_AncestorEnd  ;  rhId_Ancestor ++ )
+			{
+				if( descendants_purgeDueQ(tlngDescendantP,  byEdgeOwnership,  numRhAtPreviousPurgeDuplicates) )
+				{
+					rhombi_purgeDuplicates(tlngDescendantP);
+					numSpecialDeduplications ++;
+					numRhAtPreviousPurgeDuplicates = tlngDescendantP->numFats + tlngDescendantP->numThins;
+				}  // if( 'purge needed' )
+				for( rhId_Child = 0  ;  rhId_Child < numChildren[rhId_Ancestor]  ;  rhId_Child ++ )
+					rhombus_append_copy( tlngDescendantP,  chunkP->buffer.rhombi + (chunkP->rhId_BufferNext ++) );
+			}  // for( rhId_Ancestor ... )
+
+			free(chunkP->buffer.rhombi);
+			chunkP->buffer.rhombi = NULL;
+
+			if( NULL != childRhIds )  // No purges, as byEdgeOwnership, so the chunk's children are contiguous from rhId_ChunkStart.
+				for( rhId_Ancestor = chunkP->rhId_AncestorStart  ;  rhId_Ancestor < chunkP->rhId_AncestorEnd  ;  rhId_Ancestor ++ )
+					for( childNum = 0  ;  childNum < 5  ;  childNum ++ )
+						if( childRhIds[5 * rhId_Ancestor + childNum] >= 0 )
+							childRhIds[5 * rhId_Ancestor + childNum] += rhId_ChunkStart;
+		}  // for( chunkNum ... )
+	}  // for( waveStart ... )
+
+	free(numChildren);
+	free(threadStarted);
+	free(threads);
+	free(chunks);
+
+	return numSpecialDeduplications;
+}  // descendants_append_parallel()
+
 
 void tiling_descendant(
 	Tiling * const tlngDescendantP,
@@ -13,29 +206,49 @@ void tiling_descendant(
 )
 {
 	int rhId_Ancestor;
-	clock_t const timeBeginDescendant = clock();
-	clock_t timeBeginPart;
-	unsigned long int numRhAtPreviousPurgeDuplicates = 0;
+	int numThreads;
+	bool byEdgeOwnership, inheritNeighbours;
+	RhombId *childRhIds = NULL;
+	double const timeBeginDescendant = wallClockSeconds();
+	double timeBeginPart;  // Wall-clock, as wallClockSeconds(), not clock(), which sums the threads' CPU times.
+	long int numRhAtPreviousPurgeDuplicates = 0;
 	long int numSpecialDeduplications = 0;
 
 	if(singleStartTime == -1)
-		singleStartTime = clock();
+		singleStartTime = wallClockSeconds();
 
 	tlngDescendantP->tilingId  = tlngAncestorP->tilingId + 1;
 	printf("tiling_descendant(): tilingId=%" PRIi8 ", starting tiling_descendant().\n", tlngDescendantP->tilingId);  fflush(stdout);
 
 	tlngDescendantP->numTilings = tlngAncestorP->numTilings;
+	byEdgeOwnership = descendantsByEdgeOwnershipQ(tlngDescendantP);
+	inheritNeighbours = byEdgeOwnership  &&  descendantsInheritNeighboursQ(tlngDescendantP);
 	tlngDescendantP->rhombi_NumMax = 0;
 	tlngDescendantP->rhombi = NULL;
+	tlngDescendantP->rhombi_Mapped = false;
+	tlngDescendantP->rhombi_Spatial = false;
+	tlngDescendantP->rhombi_Scratch = false;
+	tlngDescendantP->arrays_Private = false;
 	tlngDescendantP->numFats = 0;
 	tlngDescendantP->numThins = 0;
 	tlngDescendantP->path_NumMax = 0;
 	tlngDescendantP->path = NULL;
+	tlngDescendantP->path_Mapped = false;
+	tlngDescendantP->pathRhIds = NULL;
+	tlngDescendantP->pathRhIds_Mapped = false;
 	tlngDescendantP->numPathsClosed = 0;
 	tlngDescendantP->numPathsOpen = 0;
 	tlngDescendantP->pathStats_NumMax = 0;
 	tlngDescendantP->pathStat = NULL;
+	tlngDescendantP->pathStat_Mapped = false;
 	tlngDescendantP->numPathStats = 0;  // This needed when paths_sort() with pathStat not yet assigned.
+#if HotArrays
+	tlngDescendantP->hot_NumMax = 0;
+	tlngDescendantP->hotCentres = NULL;
+	tlngDescendantP->hotBBoxes  = NULL;
+	tlngDescendantP->hotCentres_Mapped = false;
+	tlngDescendantP->hotBBoxes_Mapped  = false;
+#endif
 	tlngDescendantP->axisAligned = tlngAncestorP->axisAligned;
 	tlngDescendantP->wantedPostScriptCentre        = tlngAncestorP->wantedPostScriptCentre;
 	tlngDescendantP->wantedPostScriptAspect        = tlngAncestorP->wantedPostScriptAspect;
@@ -44,27 +257,36 @@ void tiling_descendant(
 	tlngDescendantP->wantedPostScriptNumberPaths   = 0;
 
 	tlngDescendantP->edgeLength = tlngAncestorP->edgeLength * GoldenRatioReciprocal;
+#if ExactCoordinates
+	lattice_basis_descendant(tlngDescendantP,  tlngAncestorP);
+#endif
+	tlngDescendantP->roi_numVertices    = roi_polygon( &(tlngDescendantP->roi_vertices) );
+	tlngDescendantP->roi_marginDistance = roi_margin(tlngDescendantP);
+
+	// Net of duplicates, each fat makes two fats and a thin, and each thin a fat and a thin, as in the interior of the tiling.
+	// Plus extras proportional to the boundary length, where children are not shared, and for holesFill(), and a little for
+	// very small tilings. The duplicates not yet purged, and any underestimate, are handled by rhombi_reserveOne() growing the array.
+	tlngDescendantP->rhombi_NumMax
+		= 3 * tlngAncestorP->numFats  +  2 * tlngAncestorP->numThins
+		+ 6 * sqrt(tlngAncestorP->numFats + tlngAncestorP->numThins)
+		+ 256;
+
+	if( byEdgeOwnership )
+	{
+		// No duplicates, so the number of descendants is known exactly, plus extras for holesFill() as above.
+		tlngDescendantP->rhombi_NumMax = 6 * sqrt(tlngAncestorP->numFats + tlngAncestorP->numThins)  +  256;
+		for( rhId_Ancestor = 0;  rhId_Ancestor < tlngAncestorP->numFats + tlngAncestorP->numThins;  rhId_Ancestor ++ )
+			tlngDescendantP->rhombi_NumMax += rhombus_numDescendants( tlngDescendantP,  tlngAncestorP,  tlngAncestorP->rhombi + rhId_Ancestor,  true );
+	}  // if( byEdgeOwnership )
 
-	// Scope to hold three temporary long int.
+	if( tlngDescendantP->rhombi_NumMax > RhombId_NumMax )
 	{
-		long int const rhombi_NumMax_A  // Based on the number of rhombi that will appear, with small spare. This is memory efficient.
-			= (tlngAncestorP->numFats + tlngAncestorP->numThins) * (GoldenRatioSquare * 1.1)   // Final number descendants for ordinary recursion, *1.1 for a little spare. There is here a clash between memory efficiency and speed; 1.1 might be reasonable compromise.
-			+ 6 * sqrt(tlngAncestorP->numFats + tlngAncestorP->numThins)                       // some extras, proportional to boundary length, for hole filling.
-			+ 256;                                                                             // some more spare, especially for small tilings, and to make this irrelevant for very small tilings.
-		long int const rhombi_NumMax_B  // Based on the number of rhombi that will appear, with small spare. This is memory efficient.
-			= (tlngAncestorP->numFats + tlngAncestorP->numThins) * (GoldenRatioSquare * 1.01)  // Final number descendants for ordinary recursion, *1.01 for a tiny little spare.
-			+ 6 * sqrt(tlngAncestorP->numFats + tlngAncestorP->numThins)                       // some extras, proportional to boundary length, for hole filling.
-			+ 262144;                                                                          // Small proportional extra, large fixed extra. Boundary at Ancestor having 1,112,285 rhombi, Descendant having 3,209,784.
-		long int const rhombi_NumMax_C  // Based on maximum from recursion algorithm.
-			= 5 * tlngAncestorP->numFats   // Recursion makes five new rhombi for each previous fat,  though many subsequently de-duplicated.
-			+ 4 * tlngAncestorP->numThins  // Recursion makes four new rhombi for each previous thin, though many subsequently de-duplicated.
-			+ 64;                          // The extra 64 for, in early recursions, holes_Fill().
-		tlngDescendantP->rhombi_NumMax = rhombi_NumMax_A;
-		if( tlngDescendantP->rhombi_NumMax > rhombi_NumMax_B )  tlngDescendantP->rhombi_NumMax = rhombi_NumMax_B;
-		if( tlngDescendantP->rhombi_NumMax > rhombi_NumMax_C )  tlngDescendantP->rhombi_NumMax = rhombi_NumMax_C;
-	}
+		fprintf(stderr, "tiling_descendant(): !!! rhombi_NumMax=%li too big for Neighbour.rhId: set CompactRhombi and CompactNeighbours to false !!!\n", tlngDescendantP->rhombi_NumMax);
+		fflush(stderr);
+		exit(EXIT_FAILURE);
+	}  // Too big for Neighbour.rhId
 
-	tlngDescendantP->rhombi = malloc( tlngDescendantP->rhombi_NumMax  *  sizeof(Rhombus) );
+	tlngDescendantP->rhombi = bigArray_alloc(tlngDescendantP,  tlngDescendantP->rhombi_NumMax,  sizeof(Rhombus),  "rhombi",  &(tlngDescendantP->rhombi_Mapped));
 	if( NULL == tlngDescendantP->rhombi )
 	{
 		fprintf(stderr, "tiling_descendant(): !!! NULL == tlng.rhombi !!!\n");
@@ -72,73 +294,119 @@ void tiling_descendant(
 		exit(EXIT_FAILURE);
 	}  // NULL == tlngDescendantP->rhombi
 
-	timeBeginPart = clock();
-	for( rhId_Ancestor = 0;  rhId_Ancestor < tlngAncestorP->numFats + tlngAncestorP->numThins;  rhId_Ancestor ++ )
+	if( inheritNeighbours )
 	{
-		// Purpose: if huge memory assigned, best not to use it all as that might entail copying to and from disk.
-		// An occasional purge of duplicates might lessen this. Also allows less memory to have been malloc'd.
-		if( tlngDescendantP->numFats + tlngDescendantP->numThins >= numRhAtPreviousPurgeDuplicates + 14128176  // 4G of memory, being arbitrarily occasional.
-		||  tlngDescendantP->numFats + tlngDescendantP->numThins >= tlngDescendantP->rhombi_NumMax - 8 )      // Tight against boundary: really need to purge duplicates.
+		childRhIds = malloc( 5 * (tlngAncestorP->numFats + tlngAncestorP->numThins)  *  sizeof(RhombId) );
+		if( NULL == childRhIds )
 		{
-			rhombi_purgeDuplicates(tlngDescendantP);
-			numSpecialDeduplications ++;
-			numRhAtPreviousPurgeDuplicates = tlngDescendantP->numFats + tlngDescendantP->numThins;
-		}  // if( 'purge needed' )
-		rhombus_append_descendants( tlngDescendantP,  tlngAncestorP->rhombi + rhId_Ancestor );
-	}  // for( rhId_Ancestor ... )
-	printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for %li calls of rhombus_append_descendants(), and %li call%s of rhombi_purgeDuplicates(), resulting in #Fats+#Thins=%li\n",
+			fprintf(stderr, "tiling_descendant(): !!! NULL == childRhIds !!!\n");
+			fflush(stderr);
+			exit(EXIT_FAILURE);
+		}  // NULL == childRhIds
+	}  // if( inheritNeighbours )
+
+	timeBeginPart = wallClockSeconds();
+	bigArray_adviseSequential(tlngAncestorP->rhombi,  tlngAncestorP->rhombi_NumMax,  sizeof(Rhombus),  tlngAncestorP->rhombi_Mapped,  true);  // Ancestors read in order.
+	numThreads = descendantsNumThreads(tlngDescendantP);
+	if( numThreads > 1 )
+		numSpecialDeduplications = descendants_append_parallel(tlngDescendantP,  tlngAncestorP,  &numThreads,  byEdgeOwnership,  childRhIds);  // Lowers numThreads if few ancestors.
+	else
+	{
+		numThreads = 1;
+		for( rhId_Ancestor = 0;  rhId_Ancestor < tlngAncestorP->numFats + tlngAncestorP->numThins;  rhId_Ancestor ++ )
+		{
+			if( descendants_purgeDueQ(tlngDescendantP,  byEdgeOwnership,  numRhAtPreviousPurgeDuplicates) )
+			{
+				rhombi_purgeDuplicates(tlngDescendantP);
+				numSpecialDeduplications ++;
+				numRhAtPreviousPurgeDuplicates = tlngDescendantP->numFats + tlngDescendantP->numThins;
+			}  // if( 'purge needed' )
+			rhombus_append_descendants(
+				tlngDescendantP,
+				tlngAncestorP,
+				tlngAncestorP->rhombi + rhId_Ancestor,
+				byEdgeOwnership,
+				NULL == childRhIds  ?  NULL  :  childRhIds + 5 * rhId_Ancestor
+			);
+		}  // for( rhId_Ancestor ... )
+	}  // numThreads <= 1
+	bigArray_adviseSequential(tlngAncestorP->rhombi,  tlngAncestorP->rhombi_NumMax,  sizeof(Rhombus),  tlngAncestorP->rhombi_Mapped,  false);
+	printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for %li calls of rhombus_append_descendants() on %i thread%s, and %li call%s of rhombi_purgeDuplicates(), resulting in #Fats+#Thins=%li\n",
 		tlngDescendantP->tilingId,
-		((double)clock() - timeBeginPart) / CLOCKS_PER_SEC,
+		wallClockSeconds() - timeBeginPart,
 		tlngAncestorP->numFats + tlngAncestorP->numThins,
+		numThreads,  numThreads == 1 ? "" : "s",
 		numSpecialDeduplications,  numSpecialDeduplications == 1 ? "" : "s",
 		tlngDescendantP->numThins + tlngDescendantP->numFats
 	);  fflush(stdout);
 
-	timeBeginPart = clock();
-	rhombi_purgeDuplicates(tlngDescendantP);
-	printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for rhombi_sorted_purgeDuplicates(), with #Fats=%li #Thins=%li, #Fats+#Thins=%li, /prev~=%0.4lg\n",
+	timeBeginPart = wallClockSeconds();
+	if( ! byEdgeOwnership )
+		rhombi_purgeDuplicates(tlngDescendantP);
+	if( tlngDescendantP->rhombi_NumMax > tlngDescendantP->numFats + tlngDescendantP->numThins + 6 * sqrt(tlngAncestorP->numFats + tlngAncestorP->numThins) + 256 )
+		rhombi_resize(tlngDescendantP,  tlngDescendantP->numFats + tlngDescendantP->numThins + 6 * sqrt(tlngAncestorP->numFats + tlngAncestorP->numThins) + 256);  // Trim, leaving space for holesFill().
+	printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for rhombi_sorted_purgeDuplicates()%s, with #Fats=%li #Thins=%li, #Fats+#Thins=%li, /prev~=%0.4lg\n",
 		tlngDescendantP->tilingId,
-		((double)clock() - timeBeginPart) / CLOCKS_PER_SEC,
+		wallClockSeconds() - timeBeginPart,
+		byEdgeOwnership ? " (not needed, as by edge ownership)" : "",
 		tlngDescendantP->numFats,  tlngDescendantP->numThins,  tlngDescendantP->numFats + tlngDescendantP->numThins,
 		((double)(tlngDescendantP->numThins + tlngDescendantP->numFats)) / (tlngAncestorP->numFats + tlngAncestorP->numThins)
 	);  fflush(stdout);
 
-	timeBeginPart = clock();
-	neighbours_populate(tlngDescendantP);
-	printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for neighbours_populate()\n",
+	timeBeginPart = wallClockSeconds();
+	if( inheritNeighbours )
+	{
+		neighbours_inherit(tlngDescendantP,  tlngAncestorP,  childRhIds);
+		free(childRhIds);
+		childRhIds = NULL;
+	}
+	else
+		neighbours_populate(tlngDescendantP);
+	printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for %s()\n",
 		tlngDescendantP->tilingId,
-		((double)clock() - timeBeginPart) / CLOCKS_PER_SEC
+		wallClockSeconds() - timeBeginPart,
+		inheritNeighbours ? "neighbours_inherit" : "neighbours_populate"
 	);  fflush(stdout);
 
 	if( holesFillQ(tlngDescendantP) )
 	{
-		timeBeginPart = clock();
+		timeBeginPart = wallClockSeconds();
 		holesFill(tlngDescendantP);
 		printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for holesFill()\n",
 			tlngDescendantP->tilingId,
-			((double)clock() - timeBeginPart) / CLOCKS_PER_SEC
+			wallClockSeconds() - timeBeginPart
 		);  fflush(stdout);
 	}
 	else
 		neighbours_populate(tlngDescendantP);
 
-	timeBeginPart = clock();
+	if( rhombiSpatialOrderQ(tlngDescendantP) )
+	{
+		timeBeginPart = wallClockSeconds();
+		rhombi_sortSpatially(tlngDescendantP);
+		printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for rhombi_sortSpatially()\n",
+			tlngDescendantP->tilingId,
+			wallClockSeconds() - timeBeginPart
+		);  fflush(stdout);
+	}  // rhombiSpatialOrderQ()
+
+	timeBeginPart = wallClockSeconds();
 	paths_populate(tlngDescendantP);
 	printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for paths_populate(), with #PathsClosed=%li,  #PathsOpen=%li,  (C+O)/prev~=%0.4lg\n",
 		tlngDescendantP->tilingId,
-		((double)clock() - timeBeginPart) / CLOCKS_PER_SEC,
+		wallClockSeconds() - timeBeginPart,
 		tlngDescendantP->numPathsClosed, tlngDescendantP->numPathsOpen,
 		(double)(tlngDescendantP->numPathsClosed + tlngDescendantP->numPathsOpen) / (double)(tlngAncestorP->numPathsClosed + tlngAncestorP->numPathsOpen)
 	);  fflush(stdout);
 
-	timeBeginPart = clock();
+	timeBeginPart = wallClockSeconds();
 	wanted_populate(tlngDescendantP);
 	printf(
 		"tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for wanted_populate(), "
 		"with wantedPostScriptCentreX=%.15G, CentreY=%.15G, Aspect=%.15G "
 		"==> HalfWidth=%0.15G, NumRh=%li, NumPaths=%li\n",
 		tlngDescendantP->tilingId,
-		((double)clock() - timeBeginPart) / CLOCKS_PER_SEC,
+		wallClockSeconds() - timeBeginPart,
 		tlngDescendantP->wantedPostScriptCentre.x,
 		tlngDescendantP->wantedPostScriptCentre.y,
 		tlngDescendantP->wantedPostScriptAspect,
@@ -147,27 +415,28 @@ void tiling_descendant(
 		tlngDescendantP->wantedPostScriptNumberPaths
 	);  fflush(stdout);
 
-	timeBeginPart = clock();
+	timeBeginPart = wallClockSeconds();
 	insideness_populate(tlngDescendantP);
 	printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for insideness_populate()\n",
 		tlngDescendantP->tilingId,
-		((double)clock() - timeBeginPart) / CLOCKS_PER_SEC
+		wallClockSeconds() - timeBeginPart
 	);  fflush(stdout);
 
-	timeBeginPart = clock();
+
+	timeBeginPart = wallClockSeconds();
 	pathStats_populate(tlngDescendantP);
 	printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for pathStats_populate() with #PathStats=%li,  /prev~=%0.4lg\n",
 		tlngDescendantP->tilingId,
-		((double)clock() - timeBeginPart) / CLOCKS_PER_SEC,
+		wallClockSeconds() - timeBeginPart,
 		tlngDescendantP->numPathStats,
 		(double)tlngDescendantP->numPathStats / (double)tlngAncestorP->numPathStats
 	);  fflush(stdout);
 
-	timeBeginPart = clock();
+	timeBeginPart = wallClockSeconds();
 	verifyHypothesisedProperties(tlngDescendantP);
 	printf("tiling_descendant(): tilingId=%" PRIi8 ", %0.3lfs for verifyHypothesisedProperties()\n",
 		tlngDescendantP->tilingId,
-		((double)clock() - timeBeginPart) / CLOCKS_PER_SEC
+		wallClockSeconds() - timeBeginPart
 	);  fflush(stdout);
 
 	// Simple checks: start
@@ -193,13 +462,13 @@ void tiling_descendant(
 	// Simple checks: end
 
 
-	double thisTime = (double)(clock() - timeBeginDescendant) / CLOCKS_PER_SEC;
+	double thisTime = wallClockSeconds() - timeBeginDescendant;
 	printf("tiling_descendant(): tilingId=%" PRIi8 ", numFats=%li, numThins=%li, numPathsClosed=%li, numPathsOpen=%li, numPathStats=%li"
 		", execution time ~= %0.3lf seconds; all tilings' time = %0.3lfs. (Both excl. this t's disk-writing time.)\n",
 		tlngDescendantP->tilingId, tlngDescendantP->numFats, tlngDescendantP->numThins,
 		tlngDescendantP->numPathsClosed, tlngDescendantP->numPathsOpen, tlngDescendantP->numPathStats,
 		thisTime,
-		((double)clock() - singleStartTime) / CLOCKS_PER_SEC
+		wallClockSeconds() - singleStartTime
 	);  fflush(stdout);
 
 	export_soloTiling(tlngDescendantP,  timeBeginDescendant);
@@ -217,19 +486,34 @@ void tiling_initial(
 	XY const wantedPostScriptCentre,  double const wantedPostScriptAspect
 )
 {
-	clock_t const timeBegin = clock();
+	double const timeBegin = wallClockSeconds();
 
 	tlngP->rhombi_NumMax = 0;
 	tlngP->rhombi = NULL;
+	tlngP->rhombi_Mapped = false;
+	tlngP->rhombi_Spatial = false;
+	tlngP->rhombi_Scratch = false;
+	tlngP->arrays_Private = false;
 	tlngP->numFats = 0;
 	tlngP->numThins = 0;
 	tlngP->path_NumMax = 0;
 	tlngP->path = NULL;
+	tlngP->path_Mapped = false;
+	tlngP->pathRhIds = NULL;
+	tlngP->pathRhIds_Mapped = false;
 	tlngP->numPathsClosed = 0;
 	tlngP->numPathsOpen = 0;
 	tlngP->pathStats_NumMax = 0;
 	tlngP->pathStat = NULL;
+	tlngP->pathStat_Mapped = false;
 	tlngP->numPathStats = 0;  // This needed when paths_sort() with pathStat not yet assigned.
+#if HotArrays
+	tlngP->hot_NumMax = 0;
+	tlngP->hotCentres = NULL;
+	tlngP->hotBBoxes  = NULL;
+	tlngP->hotCentres_Mapped = false;
+	tlngP->hotBBoxes_Mapped  = false;
+#endif
 
 	tlngP->rhombi_NumMax = 4;  // Initial thin, + two fats added by holesFill(), + one spare.
 
@@ -238,6 +522,9 @@ void tiling_initial(
 	tlngP->wantedPostScriptHalfWidth     = 0;
 	tlngP->wantedPostScriptNumberRhombi = 0;
 	tlngP->wantedPostScriptNumberPaths   = 0;
+	tlngP->roi_numVertices    = 0;  // No ancestors to prune.
+	tlngP->roi_vertices       = NULL;
+	tlngP->roi_marginDistance = 0;
 
 	if     ( init_thin_yNorth == init_thin_ySouth ) tlngP->edgeLength = fabs(init_thin_xNorth - init_thin_xSouth) * GoldenRatio;
 	else if( init_thin_xNorth == init_thin_xSouth ) tlngP->edgeLength = fabs(init_thin_yNorth - init_thin_ySouth) * GoldenRatio;
@@ -251,21 +538,37 @@ void tiling_initial(
 		exit(EXIT_FAILURE);
 	}  // if( NULL == tlngP->rhombi )
 	tlngP->anyPathsVeryClosed = false;
+#if ExactCoordinates
+	// Lattice's origin at the initial north, with unit[0] pointing to the initial south.
+	lattice_basis_initial(
+		tlngP,
+		(XY){.x=init_thin_xNorth,  .y=init_thin_yNorth},
+		atan2(init_thin_ySouth - init_thin_yNorth,  init_thin_xSouth - init_thin_xNorth)
+	);
+	RhombId const rhId_new = rhombus_append_exact(
+		tlngP,
+		Thin,
+		false,  // not filled hole
+		(Lattice){ .a = {0, 0, 0, 0} },
+		lattice_add( lattice_unit(-2),  lattice_unit(+2) )
+	);
+#else
 	RhombId const rhId_new = rhombus_append(
 		tlngP,
 		Thin,
 		false,  // not filled hole
 		init_thin_xNorth, init_thin_yNorth, init_thin_xSouth, init_thin_ySouth
 	);
+#endif
 	if( rhId_new < 0 )
 	{
 		fprintf(stderr, "!!! Error in tiling_initial(): rhombus_append() failed. !!!\n");
 		exit(EXIT_FAILURE);
 	}
-	tlngP->xMin = tlngP->rhombi[rhId_new].xMin;
-	tlngP->yMin = tlngP->rhombi[rhId_new].yMin;
-	tlngP->xMax = tlngP->rhombi[rhId_new].xMax;
-	tlngP->yMax = tlngP->rhombi[rhId_new].yMax;
+	tlngP->xMin = rhombus_hotBBox(tlngP, rhId_new, xMin);
+	tlngP->yMin = rhombus_hotBBox(tlngP, rhId_new, yMin);
+	tlngP->xMax = rhombus_hotBBox(tlngP, rhId_new, xMax);
+	tlngP->yMax = rhombus_hotBBox(tlngP, rhId_new, yMax);
 
 	// Most of the following redundant, unless initial tiling made more complicated.
 	rhombi_sort(tlngP,  &rhombiGt_ByY,  false);
@@ -280,7 +583,7 @@ void tiling_initial(
 	insideness_populate(tlngP);
 	pathStats_populate(tlngP);
 
-	double const angMultiple = tlngP->rhombi[0].angleDegrees / 18;
+	double const angMultiple = rhombus_angleDegrees(tlngP, &(tlngP->rhombi[0])) / 18;
 	tlngP->axisAligned = ( fabs(round(angMultiple) - angMultiple) < 0.000005 );  // A multiple of 18 degrees, to within 0.0935 dots across A3 at 3600dpi.
 
 	export_soloTiling(tlngP,  timeBegin);
@@ -292,16 +595,22 @@ void tiling_empty(Tiling * const tlngP)
 {
 	if( NULL != tlngP->pathStat )
 	{
-		free( tlngP->pathStat );
+		bigArray_free( tlngP->pathStat,  tlngP->pathStats_NumMax,  sizeof(PathStats),  tlngP->pathStat_Mapped );
 		tlngP->pathStat = NULL;
 	}
 	tlngP->pathStats_NumMax = 0;
 	tlngP->numPathStats = 0;
 
 
+	if( NULL != tlngP->pathRhIds )
+	{
+		bigArray_free( tlngP->pathRhIds,  tlngP->numFats,  sizeof(RhombId),  tlngP->pathRhIds_Mapped );
+		tlngP->pathRhIds = NULL;
+	}
+
 	if( NULL != tlngP->path )
 	{
-		free( tlngP->path );
+		bigArray_free( tlngP->path,  tlngP->path_NumMax,  sizeof(Path),  tlngP->path_Mapped );
 		tlngP->path = NULL;
 	}
 	tlngP->path_NumMax = 0 ;
@@ -311,10 +620,11 @@ void tiling_empty(Tiling * const tlngP)
 
 	if( NULL != tlngP->rhombi )
 	{
-		free( tlngP->rhombi );
+		bigArray_free( tlngP->rhombi,  tlngP->rhombi_NumMax,  sizeof(Rhombus),  tlngP->rhombi_Mapped );
 		tlngP->rhombi = NULL;
 	}
 	tlngP->rhombi_NumMax      = 0 ;
+	hotArrays_free(tlngP);
 	tlngP->numFats             = 0;
 	tlngP->numThins            = 0;
 	tlngP->wantedPostScriptNumberRhombi = 0;
@@ -26,17 +26,17 @@ long int rhombi_count_wanted(Tiling * const tlngP,  double const halfWidth,  boo
 
 	for( rhId = 0  ;  rhId < tlngP->numFats + tlngP->numThins  ;  rhId++ )
 	{
-		rhP = &(tlngP->rhombi[rhId]);
 		if(
-			rhP->xMax > xMin  &&
-			rhP->yMax > yMin  &&
-			rhP->xMin < xMax  &&
-			rhP->yMin < yMax
+			rhombus_hotBBox(tlngP, rhId, xMax) > xMin  &&
+			rhombus_hotBBox(tlngP, rhId, yMax) > yMin  &&
+			rhombus_hotBBox(tlngP, rhId, xMin) < xMax  &&
+			rhombus_hotBBox(tlngP, rhId, yMin) < yMax
 		)
 		{
 			numRhombi++;
 			if( assignWantedness )
 			{
+				rhP = &(tlngP->rhombi[rhId]);
 				rhP->wantedPostScript = true;
 				if( Fat == rhP->physique  &&  rhP->pathId >= 0 )  // second condition should be redundant
 					tlngP->path[ rhP->pathId ].wantedPostScript = true;
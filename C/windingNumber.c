@@ -28,7 +28,7 @@ int point_winding_number(register double const x,  register double const y,  con
 {
 	register RhombId rhId_This;
 	RhombId rhId_Next, rhXXX_WithinPath ;
-	Rhombus *rhThisP;
+	RhombId const * const pathRhIds = tlngP->pathRhIds + pathP_Outer->pathRhIds_Offset;
 	int wn = 0 ;  // Winding number. Inside <==> wn!=0
 
 	if(x >= pathP_Outer->xMax
@@ -37,26 +37,28 @@ int point_winding_number(register double const x,  register double const y,  con
 	|| y <= pathP_Outer->yMin)
 		return 0;
 
-	rhId_This = pathP_Outer->rhId_PathCentreClosest ;
+	rhId_This = pathRhIds[0] ;
 	for( rhXXX_WithinPath = 0  ;  rhXXX_WithinPath < pathP_Outer->pathLength ;  rhXXX_WithinPath++ )  // This technique will include the final edge, from length-1 to 0.
 	{
-		rhThisP  =  &(tlngP->rhombi[ rhId_This ]) ;
-		rhId_Next = NextInPath_RhId(tlngP->rhombi, rhThisP, pathP_Outer->pathLength, true) ;
-		if( rhId_Next < 0 )
+		if( rhXXX_WithinPath + 1 < pathP_Outer->pathLength )
+			rhId_Next = pathRhIds[ rhXXX_WithinPath + 1 ] ;
+		else if( pathP_Outer->pathClosed )
+			rhId_Next = pathRhIds[0] ;
+		else
 			break;
 
-		if( tlngP->rhombi[rhId_This].centre.y <= y )
+		if( rhombus_hotCentre(tlngP, rhId_This).y <= y )
 		{
 			// start below or on
-			if( tlngP->rhombi[rhId_Next].centre.y >  y )  // end above, so upward crossing
-				if( isLeft(x, y, tlngP->rhombi[rhId_This].centre, tlngP->rhombi[rhId_Next].centre) > 0 )  // point left of edge
+			if( rhombus_hotCentre(tlngP, rhId_Next).y >  y )  // end above, so upward crossing
+				if( isLeft(x, y, rhombus_hotCentre(tlngP, rhId_This), rhombus_hotCentre(tlngP, rhId_Next)) > 0 )  // point left of edge
 					--wn ;
 		}
 		else
 		{
 			// start above
-			if( tlngP->rhombi[rhId_Next].centre.y <= y )  // end below or on, so downward crossing
-				if( isLeft(x, y, tlngP->rhombi[rhId_This].centre, tlngP->rhombi[rhId_Next].centre) < 0 )  // point right of edge
+			if( rhombus_hotCentre(tlngP, rhId_Next).y <= y )  // end below or on, so downward crossing
+				if( isLeft(x, y, rhombus_hotCentre(tlngP, rhId_This), rhombus_hotCentre(tlngP, rhId_Next)) < 0 )  // point right of edge
 					++wn;
 		}
 
@@ -75,15 +77,16 @@ int rhombus_winding_number(const Rhombus * const rhP,  const Path * const pathP_
 		return 0;
 
 	const double paddingThreshold = 0.9999 * tlngP->edgeLength;  // Mathematically exactly 1, but minus epsilon for machine-precision failures.
-	if(rhP->xMax > pathP_Outer->xMax - paddingThreshold
-	|| rhP->yMax > pathP_Outer->yMax - paddingThreshold
-	|| rhP->xMin < pathP_Outer->xMin + paddingThreshold
-	|| rhP->yMin < pathP_Outer->yMin + paddingThreshold)
+	const RhombId rhId = rhP->rhId;
+	if(rhombus_hotBBox(tlngP, rhId, xMax) > pathP_Outer->xMax - paddingThreshold
+	|| rhombus_hotBBox(tlngP, rhId, yMax) > pathP_Outer->yMax - paddingThreshold
+	|| rhombus_hotBBox(tlngP, rhId, xMin) < pathP_Outer->xMin + paddingThreshold
+	|| rhombus_hotBBox(tlngP, rhId, yMin) < pathP_Outer->yMin + paddingThreshold)
 		return 0;
 
 	return point_winding_number(
-		rhP->centre.x + (tlngP->edgeLength / 32),  // Small offset eliminates most equalities
-		rhP->centre.y + (tlngP->edgeLength / 32),
+		rhombus_hotCentre(tlngP, rhId).x + (tlngP->edgeLength / 32),  // Small offset eliminates most equalities
+		rhombus_hotCentre(tlngP, rhId).y + (tlngP->edgeLength / 32),
 		pathP_Outer,
 		tlngP
 	);